@@ -0,0 +1,405 @@
+// Copyright 2025 Maicol Castro <maicolcastro.abc@gmail.com>.
+// Distributed under the MIT License.
+// See LICENSE.txt in the root directory of this project
+// or at https://opensource.org/license/mit.
+
+#include <atomic>
+#include <charconv>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <new>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <gcl/binary.hh>
+#include <gcl/bind.hh>
+#include <gcl/document.hh>
+#include <gcl/index.hh>
+#include <gcl/lazy.hh>
+#include <gcl/parser.hh>
+#include <gcl/stream.hh>
+#include <gcl/tokenizer.hh>
+#include "corpus.hh"
+
+using namespace gcl;
+using namespace gcl::bench;
+
+// Every allocation of the process is counted, so that a benchmark can report
+// how many a document takes.
+static std::atomic<size_t> allocationCount{0};
+
+void* operator new(size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+
+    if (void* pointer = std::malloc(size > 0 ? size : 1))
+        return pointer;
+
+    throw std::bad_alloc();
+}
+
+void* operator new(size_t size, std::align_val_t alignment) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+
+    size_t align = static_cast<size_t>(alignment);
+
+    if (void* pointer = std::aligned_alloc(align, (size + align - 1) / align * align))
+        return pointer;
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, size_t, std::align_val_t) noexcept {
+    std::free(pointer);
+}
+
+static size_t corpusSize = 1024 * 1024;
+
+// Of a dict corpus, which only has other keys, so that binding it measures
+// how fast they are skipped.
+struct SkippedFields {
+    int64_t missing = 0;
+};
+
+template<>
+struct gcl::Binding<SkippedFields> {
+    static constexpr auto fields = gcl::fields(gcl::field("missing", &SkippedFields::missing));
+};
+
+static void setCounters(benchmark::State& state, std::string const& text, size_t allocations) {
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * text.size()));
+    state.counters["allocs/doc"] = benchmark::Counter(static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+}
+
+static void benchParse(benchmark::State& state, std::string const& text) {
+    size_t allocations = 0;
+
+    for (auto _ : state) {
+        Value value;
+
+        size_t before = allocationCount.load(std::memory_order_relaxed);
+        parse(value, text);
+        allocations += allocationCount.load(std::memory_order_relaxed) - before;
+
+        benchmark::DoNotOptimize(value);
+
+        // Destruction has its own benchmark.
+        state.PauseTiming();
+        value = Value();
+        state.ResumeTiming();
+    }
+
+    setCounters(state, text, allocations);
+}
+
+static void benchParseInSitu(benchmark::State& state, std::string const& text) {
+    std::string buffer;
+    size_t allocations = 0;
+
+    for (auto _ : state) {
+        // The text is decoded in place, so each parse needs a fresh copy.
+        state.PauseTiming();
+        buffer = text;
+        state.ResumeTiming();
+
+        Value value;
+
+        size_t before = allocationCount.load(std::memory_order_relaxed);
+        parseInSitu(value, buffer.data(), buffer.size());
+        allocations += allocationCount.load(std::memory_order_relaxed) - before;
+
+        benchmark::DoNotOptimize(value);
+
+        state.PauseTiming();
+        value = Value();
+        state.ResumeTiming();
+    }
+
+    setCounters(state, text, allocations);
+}
+
+static void benchParseParallel(benchmark::State& state, std::string const& text) {
+    size_t allocations = 0;
+
+    for (auto _ : state) {
+        Value value;
+
+        size_t before = allocationCount.load(std::memory_order_relaxed);
+        parseParallel(value, text);
+        allocations += allocationCount.load(std::memory_order_relaxed) - before;
+
+        benchmark::DoNotOptimize(value);
+
+        state.PauseTiming();
+        value = Value();
+        state.ResumeTiming();
+    }
+
+    setCounters(state, text, allocations);
+}
+
+// Parses into the value of one context again and again, as a server
+// handling one request after another would.
+static void benchParseContext(benchmark::State& state, std::string const& text) {
+    ParserContext context;
+    size_t before = allocationCount.load(std::memory_order_relaxed);
+
+    for (auto _ : state) {
+        context.parse(text);
+        benchmark::DoNotOptimize(context.value());
+    }
+
+    setCounters(state, text, allocationCount.load(std::memory_order_relaxed) - before);
+}
+
+// Parses a batch of copies of the text on every hardware thread.
+static void benchParseBatch(benchmark::State& state, std::string const& text) {
+    constexpr size_t BATCH_SIZE = 16;
+
+    std::vector<std::string_view> texts(BATCH_SIZE, text);
+    std::vector<Value> outputs(BATCH_SIZE);
+    size_t allocations = 0;
+
+    for (auto _ : state) {
+        size_t before = allocationCount.load(std::memory_order_relaxed);
+        parseBatch(texts, outputs, 0);
+        allocations += allocationCount.load(std::memory_order_relaxed) - before;
+
+        benchmark::DoNotOptimize(outputs.data());
+
+        state.PauseTiming();
+
+        for (Value& output : outputs)
+            output = Value();
+
+        state.ResumeTiming();
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * text.size() * BATCH_SIZE));
+    state.counters["allocs/doc"] = benchmark::Counter(static_cast<double>(allocations) / BATCH_SIZE, benchmark::Counter::kAvgIterations);
+}
+
+template<typename T>
+static void benchBind(benchmark::State& state, std::string const& text) {
+    size_t before = allocationCount.load(std::memory_order_relaxed);
+
+    for (auto _ : state) {
+        T output{};
+        gcl::bind(output, text);
+        benchmark::DoNotOptimize(output);
+    }
+
+    setCounters(state, text, allocationCount.load(std::memory_order_relaxed) - before);
+}
+
+// `encoded` is the text encoded by `encodeBinary`.
+static void benchDecodeBinary(benchmark::State& state, std::string const& encoded) {
+    size_t allocations = 0;
+
+    for (auto _ : state) {
+        Value value;
+
+        size_t before = allocationCount.load(std::memory_order_relaxed);
+        decodeBinary(value, encoded.data(), encoded.size());
+        allocations += allocationCount.load(std::memory_order_relaxed) - before;
+
+        benchmark::DoNotOptimize(value);
+
+        state.PauseTiming();
+        value = Value();
+        state.ResumeTiming();
+    }
+
+    setCounters(state, encoded, allocations);
+}
+
+// Opens the document and reads the size of the root, which is all that is
+// lexed up front.
+static void benchLazyDocument(benchmark::State& state, std::string const& text) {
+    size_t before = allocationCount.load(std::memory_order_relaxed);
+
+    for (auto _ : state) {
+        LazyDocument document(text);
+        benchmark::DoNotOptimize(document.root().size());
+    }
+
+    setCounters(state, text, allocationCount.load(std::memory_order_relaxed) - before);
+}
+
+// Feeds the text in chunks of 64 KiB.
+static void benchStreamParser(benchmark::State& state, std::string const& text) {
+    constexpr size_t CHUNK_SIZE = 64 * 1024;
+
+    size_t allocations = 0;
+
+    for (auto _ : state) {
+        StreamParser parser;
+
+        size_t before = allocationCount.load(std::memory_order_relaxed);
+
+        for (size_t offset = 0; offset < text.size(); offset += CHUNK_SIZE)
+            parser.feed(std::string_view(text).substr(offset, CHUNK_SIZE));
+
+        parser.finish();
+        allocations += allocationCount.load(std::memory_order_relaxed) - before;
+
+        benchmark::DoNotOptimize(parser.value());
+
+        state.PauseTiming();
+        parser.reset();
+        state.ResumeTiming();
+    }
+
+    setCounters(state, text, allocations);
+}
+
+static void benchIndex(benchmark::State& state, std::string const& text) {
+    size_t before = allocationCount.load(std::memory_order_relaxed);
+
+    for (auto _ : state) {
+        StructuralIndex index;
+        index.build(text);
+        benchmark::DoNotOptimize(index.tokens().data());
+    }
+
+    setCounters(state, text, allocationCount.load(std::memory_order_relaxed) - before);
+}
+
+static void benchParseDocument(benchmark::State& state, std::string const& text) {
+    size_t before = allocationCount.load(std::memory_order_relaxed);
+
+    for (auto _ : state) {
+        Document document;
+        parse(document, text);
+        benchmark::DoNotOptimize(document.root());
+    }
+
+    setCounters(state, text, allocationCount.load(std::memory_order_relaxed) - before);
+}
+
+static void benchTokenize(benchmark::State& state, std::string const& text) {
+    size_t before = allocationCount.load(std::memory_order_relaxed);
+
+    for (auto _ : state) {
+        Tokenizer tokenizer;
+        tokenizer.setText(text.data(), text.size());
+
+        size_t count = 0;
+
+        while (tokenizer.advance())
+            ++count;
+
+        benchmark::DoNotOptimize(count);
+    }
+
+    setCounters(state, text, allocationCount.load(std::memory_order_relaxed) - before);
+}
+
+static void benchDestroy(benchmark::State& state, std::string const& text) {
+    for (auto _ : state) {
+        state.PauseTiming();
+        Value value;
+        parse(value, text);
+        state.ResumeTiming();
+
+        value = Value();
+        benchmark::DoNotOptimize(value);
+    }
+
+    setCounters(state, text, 0);
+}
+
+// Takes `--corpus_size=<bytes>` out of the arguments, before the library
+// reads the rest.
+static void readCorpusSize(int& argc, char** argv) {
+    constexpr std::string_view FLAG = "--corpus_size=";
+
+    int count = 0;
+
+    for (int i = 0; i < argc; ++i) {
+        std::string_view argument = argv[i];
+
+        if (argument.starts_with(FLAG)) {
+            std::from_chars(argument.data() + FLAG.size(), argument.data() + argument.size(), corpusSize);
+            continue;
+        }
+
+        argv[count++] = argv[i];
+    }
+
+    argc = count;
+}
+
+int main(int argc, char** argv) {
+    readCorpusSize(argc, argv);
+
+    // Results of builds with different value layouts are only comparable
+    // with this in sight.
+#if defined(GCL_COMPACT_VALUE)
+    benchmark::AddCustomContext("gcl_value_layout", "compact");
+#elif defined(GCL_FLAT_DICT)
+    benchmark::AddCustomContext("gcl_value_layout", "flat_dict");
+#else
+    benchmark::AddCustomContext("gcl_value_layout", "default");
+#endif
+
+    // Kept alive until the benchmarks have run.
+    std::vector<std::string> corpora;
+    std::vector<std::string> encodedCorpora;
+    corpora.reserve(corpusKinds().size());
+    encodedCorpora.reserve(corpusKinds().size());
+
+    for (CorpusKind kind : corpusKinds()) {
+        std::string const& text = corpora.emplace_back(makeCorpus(kind, corpusSize));
+        std::string name(corpusName(kind));
+
+        Value value;
+        parse(value, text);
+        std::string const& encoded = encodedCorpora.emplace_back(encodeBinary(value));
+
+        benchmark::RegisterBenchmark(("parse/" + name).c_str(), benchParse, std::cref(text))->Unit(benchmark::kMillisecond);
+        benchmark::RegisterBenchmark(("parse_in_situ/" + name).c_str(), benchParseInSitu, std::cref(text))->Unit(benchmark::kMillisecond);
+        benchmark::RegisterBenchmark(("parse_parallel/" + name).c_str(), benchParseParallel, std::cref(text))->Unit(benchmark::kMillisecond)->UseRealTime();
+        benchmark::RegisterBenchmark(("parse_context/" + name).c_str(), benchParseContext, std::cref(text))->Unit(benchmark::kMillisecond);
+        benchmark::RegisterBenchmark(("parse_batch/" + name).c_str(), benchParseBatch, std::cref(text))->Unit(benchmark::kMillisecond)->UseRealTime();
+        benchmark::RegisterBenchmark(("decode_binary/" + name).c_str(), benchDecodeBinary, std::cref(encoded))->Unit(benchmark::kMillisecond);
+        benchmark::RegisterBenchmark(("lazy_document/" + name).c_str(), benchLazyDocument, std::cref(text))->Unit(benchmark::kMillisecond);
+        benchmark::RegisterBenchmark(("stream_parser/" + name).c_str(), benchStreamParser, std::cref(text))->Unit(benchmark::kMillisecond);
+
+        // Only some corpora have a shape that a type can be bound to.
+        if (kind == CorpusKind::Numbers)
+            benchmark::RegisterBenchmark(("bind/" + name).c_str(), benchBind<std::vector<double>>, std::cref(text))->Unit(benchmark::kMillisecond);
+        else if (kind == CorpusKind::Strings)
+            benchmark::RegisterBenchmark(("bind/" + name).c_str(), benchBind<std::vector<std::string>>, std::cref(text))->Unit(benchmark::kMillisecond);
+        else if (kind == CorpusKind::WideDict || kind == CorpusKind::Comments || kind == CorpusKind::Mixed)
+            benchmark::RegisterBenchmark(("bind/" + name).c_str(), benchBind<SkippedFields>, std::cref(text))->Unit(benchmark::kMillisecond);
+
+        benchmark::RegisterBenchmark(("index/" + name).c_str(), benchIndex, std::cref(text))->Unit(benchmark::kMillisecond);
+        benchmark::RegisterBenchmark(("parse_document/" + name).c_str(), benchParseDocument, std::cref(text))->Unit(benchmark::kMillisecond);
+        benchmark::RegisterBenchmark(("tokenize/" + name).c_str(), benchTokenize, std::cref(text))->Unit(benchmark::kMillisecond);
+        benchmark::RegisterBenchmark(("destroy/" + name).c_str(), benchDestroy, std::cref(text))->Unit(benchmark::kMillisecond);
+    }
+
+    benchmark::Initialize(&argc, argv);
+
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+        return 1;
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    return 0;
+}
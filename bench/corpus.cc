@@ -0,0 +1,319 @@
+// Copyright 2025 Maicol Castro <maicolcastro.abc@gmail.com>.
+// Distributed under the MIT License.
+// See LICENSE.txt in the root directory of this project
+// or at https://opensource.org/license/mit.
+
+#include <array>
+#include <random>
+#include "corpus.hh"
+
+using namespace gcl::bench;
+
+static constexpr std::array<CorpusKind, 6> KINDS = {
+    CorpusKind::Nested,
+    CorpusKind::WideDict,
+    CorpusKind::Strings,
+    CorpusKind::Numbers,
+    CorpusKind::Comments,
+    CorpusKind::Mixed,
+};
+
+static constexpr std::array<std::string_view, 6> NAMES = {
+    "nested",
+    "wide_dict",
+    "strings",
+    "numbers",
+    "comments",
+    "mixed",
+};
+
+static constexpr size_t NESTING_DEPTH = 64;
+
+static constexpr std::string_view WORDS[] = {
+    "alpha", "bravo", "charlie", "delta", "echo", "foxtrot", "golf", "hotel",
+    "india", "juliett", "kilo", "lima", "mike", "november", "oscar", "papa",
+};
+
+namespace {
+
+class Generator {
+public:
+    Generator(size_t size, uint32_t seed) : m_size{size}, m_random(seed), m_text() {
+        m_text.reserve(size + size / 8);
+    }
+
+    inline bool isFull() const {
+        return m_text.size() >= m_size;
+    }
+
+    inline std::string take() {
+        return std::move(m_text);
+    }
+
+    inline void put(std::string_view text) {
+        m_text.append(text);
+    }
+
+    inline size_t pick(size_t count) {
+        return std::uniform_int_distribution<size_t>(0, count - 1)(m_random);
+    }
+
+    std::string_view word() {
+        return WORDS[pick(std::size(WORDS))];
+    }
+
+    void putKey(size_t index) {
+        put(word());
+        put("_");
+        put(std::to_string(index));
+        put(": ");
+    }
+
+    void putInt() {
+        switch (pick(4)) {
+            case 0: put(std::to_string(pick(10))); break;
+            case 1: put(std::to_string(static_cast<intptr_t>(pick(100000)) - 50000)); break;
+            case 2: put(std::to_string(m_random())); break;
+            default: put(std::to_string(static_cast<int64_t>(m_random() >> 1) * m_random())); break;
+        }
+    }
+
+    void putFloat() {
+        switch (pick(3)) {
+            case 0:
+                put(std::to_string(pick(1000)));
+                put(".");
+                put(std::to_string(pick(1000)));
+                break;
+
+            case 1:
+                put("-");
+                put(std::to_string(pick(10)));
+                put(".");
+                put(std::to_string(m_random()));
+                break;
+
+            default:
+                put(std::to_string(pick(10)));
+                put(".");
+                put(std::to_string(pick(100)));
+                put(pick(2) ? "e-" : "e+");
+                put(std::to_string(pick(30)));
+                break;
+        }
+    }
+
+    void putString(size_t length, bool hasEscapes) {
+        put("\"");
+
+        for (size_t i = 0; i < length; ++i) {
+            if (hasEscapes && pick(32) == 0) {
+                put(pick(2) ? "\\n" : "\\\"");
+            }
+            else if (pick(6) == 0) {
+                put(" ");
+            }
+            else {
+                char chr = static_cast<char>('a' + pick(26));
+                put(std::string_view(&chr, 1));
+            }
+        }
+
+        put("\"");
+    }
+
+    void putScalar() {
+        switch (pick(6)) {
+            case 0: put(pick(2) ? "true" : "false"); break;
+            case 1: put("null"); break;
+            case 2: putInt(); break;
+            case 3: putFloat(); break;
+            default: putString(4 + pick(24), false); break;
+        }
+    }
+
+    void putComment() {
+        put("# ");
+
+        for (size_t i = 0, count = 4 + pick(8); i < count; ++i) {
+            put(word());
+            put(" ");
+        }
+
+        put("{ [ , \" ]\n");
+    }
+
+    void putNested(size_t depth) {
+        if (depth == NESTING_DEPTH) {
+            putScalar();
+            return;
+        }
+
+        if (depth % 2 == 0) {
+            put("[");
+            putScalar();
+            put(", ");
+            putNested(depth + 1);
+            put("]");
+        }
+        else {
+            put("{");
+            putKey(depth);
+            putNested(depth + 1);
+            put(", ");
+            putKey(depth + 1);
+            putScalar();
+            put("}");
+        }
+    }
+
+    void putRecord(size_t index) {
+        put("{\n        ");
+        putKey(0);
+        putString(8 + pick(16), false);
+        put(",\n        ");
+        putKey(1);
+        putInt();
+        put(",\n        ");
+        putKey(2);
+        put("[");
+
+        for (size_t i = 0, count = pick(8); i < count; ++i) {
+            putFloat();
+            put(", ");
+        }
+
+        put("],\n        ");
+        putKey(3);
+        put("{enabled: ");
+        put(index % 3 == 0 ? "false" : "true");
+        put(", weight: ");
+        putFloat();
+        put("},\n    }");
+    }
+
+private:
+    size_t m_size;
+    std::mt19937 m_random;
+    std::string m_text;
+};
+
+} // namespace
+
+std::span<CorpusKind const> gcl::bench::corpusKinds() {
+    return KINDS;
+}
+
+std::string_view gcl::bench::corpusName(CorpusKind kind) {
+    return NAMES[static_cast<size_t>(kind)];
+}
+
+std::optional<CorpusKind> gcl::bench::findCorpusKind(std::string_view name) {
+    for (size_t i = 0; i < NAMES.size(); ++i) {
+        if (NAMES[i] == name)
+            return KINDS[i];
+    }
+
+    return std::nullopt;
+}
+
+std::string gcl::bench::makeCorpus(CorpusKind kind, size_t size, uint32_t seed) {
+    Generator generator(size, seed);
+
+    switch (kind) {
+        case CorpusKind::Nested:
+            generator.put("[\n");
+
+            while (!generator.isFull()) {
+                generator.putNested(0);
+                generator.put(",\n");
+            }
+
+            generator.put("]\n");
+            break;
+
+        case CorpusKind::WideDict:
+            generator.put("{\n");
+
+            for (size_t i = 0; !generator.isFull(); ++i) {
+                generator.put("    ");
+                generator.putKey(i);
+                generator.putScalar();
+                generator.put(",\n");
+            }
+
+            generator.put("}\n");
+            break;
+
+        case CorpusKind::Strings:
+            generator.put("[\n");
+
+            while (!generator.isFull()) {
+                generator.put("    ");
+                generator.putString(200 + generator.pick(1800), generator.pick(2) == 0);
+                generator.put(",\n");
+            }
+
+            generator.put("]\n");
+            break;
+
+        case CorpusKind::Numbers:
+            generator.put("[\n");
+
+            while (!generator.isFull()) {
+                for (size_t i = 0; i < 16; ++i) {
+                    if (generator.pick(2))
+                        generator.putInt();
+                    else
+                        generator.putFloat();
+
+                    generator.put(", ");
+                }
+
+                generator.put("\n");
+            }
+
+            generator.put("]\n");
+            break;
+
+        case CorpusKind::Comments:
+            generator.put("# A file that is mostly comments.\n{\n");
+
+            for (size_t i = 0; !generator.isFull(); ++i) {
+                for (size_t j = 0, count = 1 + generator.pick(3); j < count; ++j) {
+                    generator.put("    ");
+                    generator.putComment();
+                }
+
+                generator.put("    ");
+                generator.putKey(i);
+                generator.putScalar();
+                generator.put(", # ");
+                generator.put(generator.word());
+                generator.put("\n");
+            }
+
+            generator.put("}\n");
+            break;
+
+        case CorpusKind::Mixed:
+            generator.put("# Generated configuration.\n{\n");
+
+            for (size_t i = 0; !generator.isFull(); ++i) {
+                if (i % 8 == 0) {
+                    generator.put("    ");
+                    generator.putComment();
+                }
+
+                generator.put("    ");
+                generator.putKey(i);
+                generator.putRecord(i);
+                generator.put(",\n");
+            }
+
+            generator.put("}\n");
+            break;
+    }
+
+    return generator.take();
+}
@@ -0,0 +1,42 @@
+// Copyright 2025 Maicol Castro <maicolcastro.abc@gmail.com>.
+// Distributed under the MIT License.
+// See LICENSE.txt in the root directory of this project
+// or at https://opensource.org/license/mit.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace gcl::bench {
+
+// The shapes of synthetic documents, each stressing one part of the parser.
+enum class CorpusKind {
+    // Arrays and dicts nested 64 levels deep.
+    Nested,
+    // One dict with many keys.
+    WideDict,
+    // Long strings, some with escape sequences.
+    Strings,
+    // Ints and floats of every form.
+    Numbers,
+    // Small entries between many comment lines.
+    Comments,
+    // A config-like mix of all of the above.
+    Mixed,
+};
+
+std::span<CorpusKind const> corpusKinds();
+
+std::string_view corpusName(CorpusKind kind);
+
+std::optional<CorpusKind> findCorpusKind(std::string_view name);
+
+// A valid document of at least `size` bytes, the same for the same seed.
+std::string makeCorpus(CorpusKind kind, size_t size, uint32_t seed = 1);
+
+} // namespace gcl::bench
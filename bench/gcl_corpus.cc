@@ -0,0 +1,50 @@
+// Copyright 2025 Maicol Castro <maicolcastro.abc@gmail.com>.
+// Distributed under the MIT License.
+// See LICENSE.txt in the root directory of this project
+// or at https://opensource.org/license/mit.
+
+#include <charconv>
+#include <iostream>
+#include <string_view>
+#include "corpus.hh"
+
+using namespace gcl::bench;
+
+// Writes a synthetic document to the standard output, to feed other tools
+// the same inputs as `gcl_bench`.
+int main(int argc, char** argv) {
+    std::optional<CorpusKind> kind = argc >= 3 ? findCorpusKind(argv[1]) : std::nullopt;
+    size_t size = 0;
+    uint32_t seed = 1;
+
+    if (kind) {
+        std::string_view sizeText = argv[2];
+        auto result = std::from_chars(sizeText.data(), sizeText.data() + sizeText.size(), size);
+
+        if (result.ec != std::errc() || result.ptr != sizeText.data() + sizeText.size())
+            kind = std::nullopt;
+    }
+
+    if (kind && argc >= 4) {
+        std::string_view seedText = argv[3];
+        auto result = std::from_chars(seedText.data(), seedText.data() + seedText.size(), seed);
+
+        if (result.ec != std::errc() || result.ptr != seedText.data() + seedText.size())
+            kind = std::nullopt;
+    }
+
+    if (!kind) {
+        std::cout << "use: /gcl_corpus [kind] [bytes] [seed]" << std::endl;
+        std::cout << "kinds:";
+
+        for (CorpusKind each : corpusKinds())
+            std::cout << ' ' << corpusName(each);
+
+        std::cout << std::endl;
+        return 1;
+    }
+
+    std::cout << makeCorpus(*kind, size, seed);
+
+    return 0;
+}
@@ -0,0 +1,168 @@
+// Copyright 2025 Maicol Castro <maicolcastro.abc@gmail.com>.
+// Distributed under the MIT License.
+// See LICENSE.txt in the root directory of this project
+// or at https://opensource.org/license/mit.
+
+#pragma once
+
+#include <cstdint>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <string_view>
+#include "document.hh"
+#include "value.hh"
+
+// Binary encoding of a `Value`, meant to be written once and then read in
+// place, for example from a `MappedFile`. All integers are little-endian and
+// nothing is aligned:
+//
+//     header:  "GCLB", u32 version, u32 key count, u32 root offset
+//     keys:    key count times u32 offset, u32 length, then the key bytes,
+//              sorted, each key stored once
+//     value:   u8 tag, then by tag
+//              Undefined, Null, False, True: nothing
+//              Int:    i64
+//              Float:  f32
+//              Double: f64, for a float that does not fit in an f32, only
+//                      written when `Float` is a double
+//              String: u32 length, bytes
+//              Array:  u32 count, u32 byte size of the elements, elements
+//              Dict:   u32 count, u32 byte size of the entries, entries of
+//                      u32 key index and value, in key order
+//              Ref:    u32 offset of an earlier string, array or dict equal
+//                      to this one, only written with `dedup`
+//
+// The byte sizes let a reader step over a container without looking inside.
+// Documents with refs are version 2, others version 1.
+
+namespace gcl {
+
+class BinaryDocument;
+class BinaryIterator;
+
+// A value inside a `BinaryDocument`. Reading it decodes only what is asked
+// for. Throws `std::runtime_error` on a type mismatch, like `Value`, and if
+// the data turns out to be truncated or corrupt.
+class BinaryValue {
+public:
+    ValueType type() const;
+
+    bool getBool() const;
+    intptr_t getInt() const;
+    Float getFloat() const;
+
+    // The view points into the document's buffer.
+    std::string_view getString() const;
+
+    // Element count of an array or entry count of a dict.
+    size_t size() const;
+
+    // Array element at `index`, found by stepping over the ones before it.
+    BinaryValue at(size_t index) const;
+
+    // Dict entry named `key`, or nothing if there is none.
+    std::optional<BinaryValue> find(std::string_view key) const;
+
+    // Iterates over the elements of an array or the entries of a dict.
+    BinaryIterator begin() const;
+    BinaryIterator end() const;
+
+    // Builds the `Value` tree of this value. Refs are expanded, so the tree
+    // holds a full copy of every repeated subtree: deduplication saves memory
+    // only while the document is read in place, not once it is decoded.
+    void decode(Value& output, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) const;
+
+private:
+    friend class BinaryDocument;
+    friend class BinaryIterator;
+
+    BinaryDocument const* m_document;
+    size_t m_offset;
+
+    // Follows the ref at `offset`, if any.
+    BinaryValue(BinaryDocument const* document, size_t offset);
+
+    void expectTag(uint8_t first, uint8_t last, char const* function) const;
+    bool decodeShallow(Value& output, std::pmr::memory_resource* resource) const;
+};
+
+struct BinaryEntry {
+    // Empty for array elements.
+    std::string_view key;
+    BinaryValue value;
+};
+
+class BinaryIterator {
+public:
+    BinaryEntry operator *() const;
+    BinaryIterator& operator ++();
+
+    inline bool operator ==(BinaryIterator const& that) const {
+        return m_offset == that.m_offset;
+    }
+
+private:
+    friend class BinaryValue;
+
+    BinaryDocument const* m_document;
+    size_t m_offset;
+    bool m_isDict;
+
+    BinaryIterator(BinaryDocument const* document, size_t offset, bool isDict)
+        : m_document{document}, m_offset{offset}, m_isDict{isDict}
+    {}
+};
+
+// A view of an encoded buffer, which must outlive it. Only the header is
+// checked up front; throws `std::runtime_error` if it is not valid.
+class BinaryDocument {
+public:
+    BinaryDocument(char const* data, size_t size);
+
+    inline explicit BinaryDocument(std::string_view data) : BinaryDocument(data.data(), data.size()) {}
+
+    inline BinaryValue root() const {
+        return BinaryValue(this, m_rootOffset);
+    }
+
+    inline size_t keyCount() const {
+        return m_keyCount;
+    }
+
+    std::string_view key(size_t index) const;
+
+private:
+    friend class BinaryValue;
+    friend class BinaryIterator;
+
+    unsigned char const* m_data;
+    size_t m_size;
+    size_t m_keyCount;
+    size_t m_rootOffset;
+
+    void check(size_t offset, size_t length) const;
+    uint8_t readU8(size_t offset) const;
+    uint32_t readU32(size_t offset) const;
+    uint64_t readU64(size_t offset) const;
+    size_t skip(size_t offset) const;
+    size_t resolve(size_t offset) const;
+    std::optional<size_t> findKey(std::string_view key) const;
+};
+
+struct EncodeOptions {
+    // Write each string, array and dict equal to one already written as a
+    // ref to it, so that repeated subtrees are stored, and read in place,
+    // once. Subtrees are found by a structural hash of the value. Decoding
+    // expands the refs again, so a decoded `Value` takes as much memory as
+    // the original.
+    bool dedup = false;
+};
+
+std::string encodeBinary(Value const& value, EncodeOptions const& options = {});
+
+// Decode a whole buffer, like `gcl::parse` does for text.
+void decodeBinary(Value& output, char const* data, size_t size);
+void decodeBinary(Document& output, char const* data, size_t size);
+
+} // namespace gcl
@@ -0,0 +1,330 @@
+// Copyright 2025 Maicol Castro <maicolcastro.abc@gmail.com>.
+// Distributed under the MIT License.
+// See LICENSE.txt in the root directory of this project
+// or at https://opensource.org/license/mit.
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <bitset>
+#include <cstdint>
+#include <format>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "exception.hh"
+#include "tokenizer.hh"
+
+namespace gcl {
+
+// Parsing straight into user types, without building a `Value` tree.
+//
+// A struct is made bindable by specializing `Binding` with the list of its
+// fields:
+//
+//     template<>
+//     struct gcl::Binding<Server> {
+//         static constexpr auto fields = gcl::fields(
+//             gcl::field("host", &Server::host),
+//             gcl::field("port", &Server::port));
+//     };
+//
+// Fields can be bools, integers, floats, `std::string`s, `std::vector`s and
+// `std::optional`s of bindable types, or other bound structs. Keys are
+// matched with a perfect hash built at compile time. Fields missing from the
+// input keep their value, and unknown keys are skipped.
+template<typename T>
+struct Binding;
+
+template<typename T, typename M>
+struct Field {
+    std::string_view name;
+    M T::* member;
+};
+
+template<typename T, typename M>
+constexpr Field<T, M> field(std::string_view name, M T::* member) {
+    return { name, member };
+}
+
+template<typename... Fields>
+constexpr std::tuple<Fields...> fields(Fields... fields) {
+    return { fields... };
+}
+
+constexpr uint32_t hashKey(std::string_view key, uint32_t seed) {
+    uint32_t hash = 2166136261u ^ seed;
+
+    for (char chr : key) {
+        hash ^= static_cast<unsigned char>(chr);
+        hash *= 16777619u;
+    }
+
+    hash ^= hash >> 15;
+    hash *= 0x2C1B3C6Du;
+    hash ^= hash >> 12;
+
+    return hash;
+}
+
+// Maps each of `N` keys to its index with a single probe.
+template<size_t N>
+struct PerfectHash {
+    static constexpr size_t MAX_SIZE = std::bit_ceil(N == 0 ? size_t(1) : N) * 8;
+
+    uint32_t seed = 0;
+    uint32_t mask = 0;
+
+    // Index of the key plus one, or zero for empty slots.
+    std::array<uint16_t, MAX_SIZE> slots = {};
+
+    constexpr PerfectHash(std::array<std::string_view, N> const& keys) {
+        for (size_t size = MAX_SIZE / 4; size <= MAX_SIZE; size *= 2) {
+            for (uint32_t candidate = 0; candidate < 256; ++candidate) {
+                if (tryBuild(keys, candidate, size - 1))
+                    return;
+            }
+        }
+
+        throw "could not find a perfect hash for the keys";
+    }
+
+    constexpr int find(std::string_view key) const {
+        return static_cast<int>(slots[hashKey(key, seed) & mask]) - 1;
+    }
+
+private:
+    constexpr bool tryBuild(std::array<std::string_view, N> const& keys, uint32_t candidate, uint32_t candidateMask) {
+        for (size_t i = 0; i < N; ++i) {
+            uint16_t& slot = slots[hashKey(keys[i], candidate) & candidateMask];
+
+            if (slot != 0) {
+                // Only clear the slots used by this attempt, the table is
+                // much larger than the key count.
+                for (size_t j = 0; j < i; ++j)
+                    slots[hashKey(keys[j], candidate) & candidateMask] = 0;
+
+                return false;
+            }
+
+            slot = static_cast<uint16_t>(i + 1);
+        }
+
+        seed = candidate;
+        mask = candidateMask;
+
+        return true;
+    }
+};
+
+template<typename T>
+struct BindingTable {
+    static constexpr auto& FIELDS = Binding<T>::fields;
+    static constexpr size_t SIZE = std::tuple_size_v<std::remove_cvref_t<decltype(FIELDS)>>;
+
+    static constexpr std::array<std::string_view, SIZE> NAMES = std::apply([](auto const&... fields) {
+        return std::array<std::string_view, SIZE>{ fields.name... };
+    }, FIELDS);
+
+    static constexpr PerfectHash<SIZE> HASH = PerfectHash<SIZE>(NAMES);
+};
+
+template<typename T>
+struct IsVector : std::false_type {};
+
+template<typename T, typename A>
+struct IsVector<std::vector<T, A>> : std::true_type {};
+
+template<typename T>
+struct IsOptional : std::false_type {};
+
+template<typename T>
+struct IsOptional<std::optional<T>> : std::true_type {};
+
+template<typename T>
+struct IsString : std::false_type {};
+
+template<typename T, typename A>
+struct IsString<std::basic_string<char, T, A>> : std::true_type {};
+
+class Binder {
+public:
+    Binder(char const* chars, size_t length) : m_tokenizer() {
+        m_tokenizer.setText(chars, length);
+        m_tokenizer.advance();
+    }
+
+    template<typename T>
+    void read(T& output);
+
+    // Skips the current value, checking its syntax as the parser would. Keys
+    // defined twice in a skipped dict are not detected.
+    void skip();
+
+private:
+    Tokenizer m_tokenizer;
+
+    template<typename T>
+    void readStruct(T& output);
+
+    template<typename T>
+    void readField(T& output, size_t index);
+
+    void skipScalar();
+
+    [[noreturn]] void throwTypeMismatch(char const* expected);
+
+    inline bool isPunctuaction(Punctuaction punctuaction) const {
+        Token const& token = m_tokenizer.token();
+        return token.kind == TokenKind::Punctuaction && token.data.punctuaction == punctuaction;
+    }
+
+    inline void expectPunctuaction(Punctuaction punctuaction, char const* text) {
+        if (!isPunctuaction(punctuaction))
+            throw GclException(GclErrorID::ExpectedPunctuaction, m_tokenizer.spanOf(m_tokenizer.token()), std::format("expected `{}` but found `{}`", text, m_tokenizer.token()));
+
+        m_tokenizer.advance();
+    }
+};
+
+// Parses `chars` into `output`. Throws `GclException` on syntax errors and on
+// values that do not fit the type of their field.
+template<typename T>
+void bind(T& output, char const* chars, size_t length) {
+    Binder binder(chars, length);
+    binder.read(output);
+}
+
+template<typename T>
+void bind(T& output, std::string_view text) {
+    bind(output, text.data(), text.length());
+}
+
+template<typename T>
+void Binder::read(T& output) {
+    Token& token = m_tokenizer.token();
+
+    if constexpr (std::is_same_v<T, bool>) {
+        if (token.kind != TokenKind::Identifier || (token.data.identifier != "true" && token.data.identifier != "false"))
+            throwTypeMismatch("a bool");
+
+        output = token.data.identifier == "true";
+        m_tokenizer.advance();
+    }
+    else if constexpr (std::is_integral_v<T>) {
+        if (token.kind != TokenKind::Int)
+            throwTypeMismatch("an int");
+
+        intptr_t value = static_cast<intptr_t>(token.data.i);
+
+        if (!std::in_range<T>(value))
+            throw GclException(GclErrorID::ValueOutOfRange, m_tokenizer.spanOf(token), std::format("value `{}` is out of range", value));
+
+        output = static_cast<T>(value);
+        m_tokenizer.advance();
+    }
+    else if constexpr (std::is_floating_point_v<T>) {
+        if (token.kind == TokenKind::Float)
+            output = static_cast<T>(token.data.f);
+        else if (token.kind == TokenKind::Int)
+            output = static_cast<T>(static_cast<intptr_t>(token.data.i));
+        else
+            throwTypeMismatch("a float");
+
+        m_tokenizer.advance();
+    }
+    else if constexpr (IsString<T>::value) {
+        if (token.kind != TokenKind::String)
+            throwTypeMismatch("a string");
+
+        output.assign(token.data.string);
+        m_tokenizer.advance();
+    }
+    else if constexpr (IsOptional<T>::value) {
+        if (token.kind == TokenKind::Identifier && token.data.identifier == "null") {
+            output.reset();
+            m_tokenizer.advance();
+        }
+        else {
+            read(output.emplace());
+        }
+    }
+    else if constexpr (IsVector<T>::value) {
+        if (!isPunctuaction(Punctuaction::Lsqb))
+            throwTypeMismatch("an array");
+
+        output.clear();
+        m_tokenizer.advance();
+
+        while (!isPunctuaction(Punctuaction::Rsqb)) {
+            read(output.emplace_back());
+
+            if (!isPunctuaction(Punctuaction::Comma))
+                break;
+
+            m_tokenizer.advance();
+        }
+
+        expectPunctuaction(Punctuaction::Rsqb, "]");
+    }
+    else {
+        readStruct(output);
+    }
+}
+
+template<typename T>
+void Binder::readStruct(T& output) {
+    using Table = BindingTable<T>;
+
+    Token& token = m_tokenizer.token();
+
+    if (!isPunctuaction(Punctuaction::Lbrace))
+        throwTypeMismatch("a dict");
+
+    std::bitset<Table::SIZE> isDefined;
+
+    m_tokenizer.advance();
+
+    while (token.kind == TokenKind::Identifier) {
+        int index = Table::HASH.find(token.data.identifier);
+
+        if (index >= 0 && Table::NAMES[index] != token.data.identifier)
+            index = -1;
+
+        if (index >= 0) {
+            if (isDefined[index])
+                throw GclException(GclErrorID::KeyAlreadyDefined, m_tokenizer.spanOf(token), std::format("key `{}` already defined", token.data.identifier));
+
+            isDefined[index] = true;
+        }
+
+        m_tokenizer.advance();
+        expectPunctuaction(Punctuaction::Colon, ":");
+
+        if (index >= 0)
+            readField(output, index);
+        else
+            skip();
+
+        if (!isPunctuaction(Punctuaction::Comma))
+            break;
+
+        m_tokenizer.advance();
+    }
+
+    expectPunctuaction(Punctuaction::Rbrace, "}");
+}
+
+template<typename T>
+void Binder::readField(T& output, size_t index) {
+    [&]<size_t... I>(std::index_sequence<I...>) {
+        ((index == I ? (read(output.*std::get<I>(BindingTable<T>::FIELDS).member), true) : false) || ...);
+    }(std::make_index_sequence<BindingTable<T>::SIZE>());
+}
+
+} // namespace gcl
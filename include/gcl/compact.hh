@@ -0,0 +1,489 @@
+// Copyright 2025 Maicol Castro <maicolcastro.abc@gmail.com>.
+// Distributed under the MIT License.
+// See LICENSE.txt in the root directory of this project
+// or at https://opensource.org/license/mit.
+
+#pragma once
+
+#include <algorithm>
+#include <compare>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+// Containers of 24 bytes, which replace `String` and `Array` when
+// GCL_COMPACT_VALUE is defined, so that a `Value` takes 32 bytes instead of
+// 48 or 64. Both keep their size in 32 bits next to their memory resource,
+// like the `std::pmr` containers they replace.
+
+namespace gcl {
+
+// An immutable string. Strings of up to `INLINE_CAPACITY` characters are
+// stored inline, longer ones in a block of exactly their length, or in
+// someone else's memory if borrowed. Unlike `std::string`, its characters
+// are not followed by a null.
+class CompactString {
+public:
+    using allocator_type = std::pmr::polymorphic_allocator<char>;
+    using value_type = char;
+    using size_type = size_t;
+    using const_iterator = char const*;
+    using iterator = const_iterator;
+
+    static constexpr size_t INLINE_CAPACITY = 12;
+    static constexpr size_t MAX_LENGTH = INT32_MAX;
+
+    CompactString() noexcept : CompactString(allocator_type()) {}
+
+    explicit CompactString(allocator_type allocator) noexcept
+        : m_resource{allocator.resource()}, m_storage{}, m_length{0}, m_isBorrowed{false}
+    {}
+
+    CompactString(char const* text, allocator_type allocator = {}) : CompactString(allocator) {
+        assign(text);
+    }
+
+    // From anything that converts to a view, such as a `std::string`.
+    template<typename T> requires (!std::is_same_v<T, CompactString> && std::is_convertible_v<T const&, std::string_view>)
+    explicit CompactString(T const& text, allocator_type allocator = {}) : CompactString(allocator) {
+        assign(text);
+    }
+
+    // Copies use the default resource, like those of `std::pmr::string`.
+    CompactString(CompactString const& that, allocator_type allocator = {}) : CompactString(allocator) {
+        assign(that.view());
+    }
+
+    CompactString(CompactString&& that) noexcept
+        : m_resource{that.m_resource}, m_length{that.m_length}, m_isBorrowed{that.m_isBorrowed}
+    {
+        std::memcpy(m_storage, that.m_storage, sizeof(m_storage));
+        that.m_length = 0;
+        that.m_isBorrowed = false;
+    }
+
+    CompactString(CompactString&& that, allocator_type allocator) : CompactString(allocator) {
+        *this = std::move(that);
+    }
+
+    inline ~CompactString() {
+        release();
+    }
+
+    CompactString& operator =(CompactString const& that) {
+        if (this != &that)
+            assign(that.view());
+
+        return *this;
+    }
+
+    // The characters are only taken over if both use the same resource, or
+    // if they are borrowed.
+    CompactString& operator =(CompactString&& that) {
+        if (this == &that)
+            return *this;
+
+        if (!isInline(that.m_length) && !that.m_isBorrowed && *m_resource != *that.m_resource) {
+            assign(that.view());
+            return *this;
+        }
+
+        release();
+
+        std::memcpy(m_storage, that.m_storage, sizeof(m_storage));
+        m_length = that.m_length;
+        m_isBorrowed = that.m_isBorrowed;
+        that.m_length = 0;
+        that.m_isBorrowed = false;
+
+        return *this;
+    }
+
+    // A string that points to `text` instead of copying it, unless it fits
+    // inline, so `text` must outlive it. Copies of it own their characters.
+    static CompactString borrow(std::string_view text, allocator_type allocator = {}) {
+        CompactString string(allocator);
+
+        if (isInline(text.length())) {
+            string.assign(text);
+            return string;
+        }
+
+        if (text.length() > MAX_LENGTH)
+            throw std::length_error("CompactString -> string too long");
+
+        char const* chars = text.data();
+        std::memcpy(string.m_storage, &chars, sizeof(chars));
+        string.m_length = static_cast<uint32_t>(text.length());
+        string.m_isBorrowed = true;
+
+        return string;
+    }
+
+    inline bool isBorrowed() const {
+        return m_isBorrowed;
+    }
+
+    inline allocator_type get_allocator() const {
+        return m_resource;
+    }
+
+    inline char const* data() const {
+        return isInline(m_length) ? m_storage : heapChars();
+    }
+
+    inline size_t size() const {
+        return m_length;
+    }
+
+    inline size_t length() const {
+        return m_length;
+    }
+
+    inline bool empty() const {
+        return m_length == 0;
+    }
+
+    inline char const* begin() const {
+        return data();
+    }
+
+    inline char const* end() const {
+        return data() + m_length;
+    }
+
+    inline char operator [](size_t index) const {
+        return data()[index];
+    }
+
+    inline std::string_view view() const {
+        return std::string_view(data(), m_length);
+    }
+
+    inline operator std::string_view() const {
+        return view();
+    }
+
+    friend inline bool operator ==(CompactString const& a, CompactString const& b) {
+        return a.view() == b.view();
+    }
+
+    friend inline std::strong_ordering operator <=>(CompactString const& a, CompactString const& b) {
+        return a.view() <=> b.view();
+    }
+
+    template<typename T> requires (!std::is_same_v<T, CompactString> && std::is_convertible_v<T const&, std::string_view>)
+    friend inline bool operator ==(CompactString const& a, T const& b) {
+        return a.view() == std::string_view(b);
+    }
+
+    template<typename T> requires (!std::is_same_v<T, CompactString> && std::is_convertible_v<T const&, std::string_view>)
+    friend inline std::strong_ordering operator <=>(CompactString const& a, T const& b) {
+        return a.view() <=> std::string_view(b);
+    }
+
+private:
+    std::pmr::memory_resource* m_resource;
+
+    // The characters of an inline string, otherwise a pointer to them.
+    char m_storage[INLINE_CAPACITY];
+    uint32_t m_length : 31;
+    uint32_t m_isBorrowed : 1;
+
+    static inline bool isInline(size_t length) {
+        return length <= INLINE_CAPACITY;
+    }
+
+    inline char* heapChars() const {
+        char* chars;
+        std::memcpy(&chars, m_storage, sizeof(chars));
+        return chars;
+    }
+
+    inline void release() {
+        if (!isInline(m_length) && !m_isBorrowed)
+            m_resource->deallocate(heapChars(), m_length, 1);
+
+        m_length = 0;
+        m_isBorrowed = false;
+    }
+
+    void assign(std::string_view text) {
+        if (text.length() > MAX_LENGTH)
+            throw std::length_error("CompactString -> string too long");
+
+        // Copied before releasing, as `text` may point into this string.
+        char storage[INLINE_CAPACITY];
+
+        if (isInline(text.length())) {
+            std::memcpy(storage, text.data(), text.length());
+        }
+        else {
+            char* chars = static_cast<char*>(m_resource->allocate(text.length(), 1));
+            std::memcpy(chars, text.data(), text.length());
+            std::memcpy(storage, &chars, sizeof(chars));
+        }
+
+        release();
+
+        std::memcpy(m_storage, storage, sizeof(m_storage));
+        m_length = static_cast<uint32_t>(text.length());
+    }
+};
+
+static_assert(sizeof(CompactString) == 24);
+static_assert(sizeof(char*) <= CompactString::INLINE_CAPACITY);
+
+// A vector with the interface `std::pmr::vector` offers to `gcl::Array` and
+// `BasicFlatDict`. Elements are built with uses-allocator construction, like
+// in `std::pmr` containers, so that the keys of dict entries share its
+// resource.
+//
+// It is a template only so that it can be instantiated with `Value` before
+// that type is complete.
+template<typename T>
+class CompactVector {
+public:
+    using value_type = T;
+    using allocator_type = std::pmr::polymorphic_allocator<T>;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using reference = T&;
+    using const_reference = T const&;
+    using pointer = T*;
+    using const_pointer = T const*;
+    using iterator = T*;
+    using const_iterator = T const*;
+
+    CompactVector() noexcept : CompactVector(allocator_type()) {}
+
+    explicit CompactVector(allocator_type allocator) noexcept
+        : m_resource{allocator.resource()}, m_data{nullptr}, m_size{0}, m_capacity{0}
+    {}
+
+    CompactVector(std::initializer_list<T> elements, allocator_type allocator = {}) : CompactVector(allocator) {
+        reserve(elements.size());
+
+        for (T const& element : elements)
+            emplace_back(element);
+    }
+
+    // Copies use the default resource, like those of `std::pmr::vector`.
+    CompactVector(CompactVector const& that) : CompactVector(that, allocator_type()) {}
+
+    CompactVector(CompactVector const& that, allocator_type allocator) : CompactVector(allocator) {
+        reserve(that.m_size);
+
+        for (T const& element : that)
+            emplace_back(element);
+    }
+
+    CompactVector(CompactVector&& that) noexcept
+        : m_resource{that.m_resource}, m_data{that.m_data}, m_size{that.m_size}, m_capacity{that.m_capacity}
+    {
+        that.m_data = nullptr;
+        that.m_size = 0;
+        that.m_capacity = 0;
+    }
+
+    CompactVector(CompactVector&& that, allocator_type allocator) : CompactVector(allocator) {
+        *this = std::move(that);
+    }
+
+    inline ~CompactVector() {
+        clear();
+        deallocate();
+    }
+
+    CompactVector& operator =(CompactVector const& that) {
+        if (this != &that) {
+            clear();
+            reserve(that.m_size);
+
+            for (T const& element : that)
+                emplace_back(element);
+        }
+
+        return *this;
+    }
+
+    // The elements are only taken over if both use the same resource,
+    // otherwise they are moved one by one.
+    CompactVector& operator =(CompactVector&& that) {
+        if (this == &that)
+            return *this;
+
+        clear();
+
+        if (*m_resource == *that.m_resource) {
+            deallocate();
+
+            m_data = std::exchange(that.m_data, nullptr);
+            m_size = std::exchange(that.m_size, 0);
+            m_capacity = std::exchange(that.m_capacity, 0);
+        }
+        else {
+            reserve(that.m_size);
+
+            for (T& element : that)
+                emplace_back(std::move(element));
+
+            that.clear();
+        }
+
+        return *this;
+    }
+
+    inline allocator_type get_allocator() const {
+        return m_resource;
+    }
+
+    inline iterator begin() { return m_data; }
+    inline iterator end() { return m_data + m_size; }
+    inline const_iterator begin() const { return m_data; }
+    inline const_iterator end() const { return m_data + m_size; }
+    inline const_iterator cbegin() const { return m_data; }
+    inline const_iterator cend() const { return m_data + m_size; }
+
+    inline size_t size() const { return m_size; }
+    inline size_t capacity() const { return m_capacity; }
+    inline bool empty() const { return m_size == 0; }
+
+    inline T* data() { return m_data; }
+    inline T const* data() const { return m_data; }
+
+    inline T& operator [](size_t index) { return m_data[index]; }
+    inline T const& operator [](size_t index) const { return m_data[index]; }
+
+    inline T& front() { return m_data[0]; }
+    inline T const& front() const { return m_data[0]; }
+    inline T& back() { return m_data[m_size - 1]; }
+    inline T const& back() const { return m_data[m_size - 1]; }
+
+    void reserve(size_t capacity) {
+        if (capacity > m_capacity)
+            relocate(allocate(capacity), capacity);
+    }
+
+    void clear() {
+        std::destroy_n(m_data, m_size);
+        m_size = 0;
+    }
+
+    template<typename... Args>
+    T& emplace_back(Args&&... args) {
+        if (m_size < m_capacity) {
+            allocator_type(m_resource).construct(m_data + m_size, std::forward<Args>(args)...);
+            return m_data[m_size++];
+        }
+
+        // The new element is built before the others are moved, as `args`
+        // may refer to one of them.
+        size_t capacity = m_capacity == 0 ? 4 : size_t(m_capacity) * 2;
+        T* data = allocate(capacity);
+
+        try {
+            allocator_type(m_resource).construct(data + m_size, std::forward<Args>(args)...);
+        }
+        catch (...) {
+            allocator_type(m_resource).deallocate(data, capacity);
+            throw;
+        }
+
+        relocate(data, capacity);
+
+        return m_data[m_size++];
+    }
+
+    inline void push_back(T const& element) {
+        emplace_back(element);
+    }
+
+    inline void push_back(T&& element) {
+        emplace_back(std::move(element));
+    }
+
+    inline void pop_back() {
+        std::destroy_at(m_data + --m_size);
+    }
+
+    template<typename... Args>
+    iterator emplace(const_iterator position, Args&&... args) {
+        size_t index = position - m_data;
+
+        if (index == m_size) {
+            emplace_back(std::forward<Args>(args)...);
+            return m_data + index;
+        }
+
+        T element = std::make_obj_using_allocator<T>(allocator_type(m_resource), std::forward<Args>(args)...);
+
+        emplace_back(std::move(back()));
+        std::move_backward(m_data + index, m_data + m_size - 2, m_data + m_size - 1);
+        m_data[index] = std::move(element);
+
+        return m_data + index;
+    }
+
+    inline iterator insert(const_iterator position, T const& element) {
+        return emplace(position, element);
+    }
+
+    inline iterator insert(const_iterator position, T&& element) {
+        return emplace(position, std::move(element));
+    }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        T* begin = m_data + (first - m_data);
+        T* end = std::move(m_data + (last - m_data), m_data + m_size, begin);
+
+        std::destroy(end, m_data + m_size);
+        m_size = static_cast<uint32_t>(end - m_data);
+
+        return begin;
+    }
+
+    inline iterator erase(const_iterator position) {
+        return erase(position, position + 1);
+    }
+
+private:
+    std::pmr::memory_resource* m_resource;
+    T* m_data;
+    uint32_t m_size;
+    uint32_t m_capacity;
+
+    T* allocate(size_t capacity) {
+        if (capacity > UINT32_MAX)
+            throw std::length_error("CompactVector -> too many elements");
+
+        return allocator_type(m_resource).allocate(capacity);
+    }
+
+    inline void deallocate() {
+        if (m_data != nullptr) {
+            allocator_type(m_resource).deallocate(m_data, m_capacity);
+            m_data = nullptr;
+            m_capacity = 0;
+        }
+    }
+
+    // Moves the elements to `data`, a block of `capacity` elements, and
+    // frees the old one.
+    void relocate(T* data, size_t capacity) {
+        std::uninitialized_move_n(m_data, m_size, data);
+        std::destroy_n(m_data, m_size);
+        deallocate();
+
+        m_data = data;
+        m_capacity = static_cast<uint32_t>(capacity);
+    }
+};
+
+} // namespace gcl
@@ -0,0 +1,120 @@
+// Copyright 2025 Maicol Castro <maicolcastro.abc@gmail.com>.
+// Distributed under the MIT License.
+// See LICENSE.txt in the root directory of this project
+// or at https://opensource.org/license/mit.
+
+#pragma once
+
+#include <memory>
+#include <memory_resource>
+#include <utility>
+#include "key.hh"
+#include "value.hh"
+
+namespace gcl {
+
+// A value tree whose strings, arrays and dict entries are all allocated from
+// a monotonic arena owned by the document. Dict keys are interned in a
+// `KeyPool` of the document, so each distinct key is stored once.
+//
+// The root is never destroyed: the arena is released as a single block
+// instead, without walking the tree. Values stored in the document must
+// therefore be allocated from `resource()`, as `gcl::parse` does, otherwise
+// their memory is leaked.
+//
+// Values in the tree keep the arena as their allocator when they are moved,
+// so a value moved out of `root()` is only valid as long as the document is
+// not destroyed or cleared. `release()` copies the tree out instead.
+class Document {
+public:
+    Document()
+        : m_arena{std::make_unique<std::pmr::monotonic_buffer_resource>()},
+          m_keys{std::make_unique<KeyPool>(m_arena.get())}
+    {
+        new (&m_root) Value();
+    }
+
+    explicit Document(size_t initialSize)
+        : m_arena{std::make_unique<std::pmr::monotonic_buffer_resource>(initialSize)},
+          m_keys{std::make_unique<KeyPool>(m_arena.get())}
+    {
+        new (&m_root) Value();
+    }
+
+    Document(Document const&) = delete;
+
+    inline Document(Document&& that) : m_arena{std::move(that.m_arena)}, m_keys{std::move(that.m_keys)} {
+        new (&m_root) Value(std::move(that.m_root));
+    }
+
+    inline ~Document() {}
+
+    Document& operator =(Document const&) = delete;
+
+    inline Document& operator =(Document&& that) {
+        m_keys = std::move(that.m_keys);
+        m_arena = std::move(that.m_arena);
+        new (&m_root) Value(std::move(that.m_root));
+
+        return *this;
+    }
+
+    inline Value& root() {
+        return m_root;
+    }
+
+    inline Value const& root() const {
+        return m_root;
+    }
+
+    inline std::pmr::memory_resource* resource() {
+        ensureArena();
+        return m_arena.get();
+    }
+
+    inline KeyPool& keys() {
+        ensureArena();
+        return *m_keys;
+    }
+
+    // Copies the tree into the default resource, so that it outlives the
+    // document, and clears the document.
+    inline Value release() {
+        Value value(std::as_const(m_root));
+        clear();
+
+        return value;
+    }
+
+    // Drops the tree and returns every arena block to the upstream resource.
+    inline void clear() {
+        new (&m_root) Value();
+
+        if (m_arena == nullptr) {
+            ensureArena();
+            return;
+        }
+
+        m_keys->clear();
+        m_arena->release();
+    }
+
+private:
+    std::unique_ptr<std::pmr::monotonic_buffer_resource> m_arena;
+    std::unique_ptr<KeyPool> m_keys;
+
+    union {
+        Value m_root;
+    };
+
+    // A moved-from document has neither an arena nor a key pool, and gets new
+    // ones when it is used again.
+    inline void ensureArena() {
+        if (m_arena == nullptr) {
+            m_arena = std::make_unique<std::pmr::monotonic_buffer_resource>();
+            m_keys = std::make_unique<KeyPool>(m_arena.get());
+        }
+    }
+};
+
+} // namespace gcl
@@ -7,6 +7,7 @@
 
 #include <exception>
 #include <string>
+#include <string_view>
 #include "misc.hh"
 
 namespace gcl {
@@ -21,12 +22,43 @@ enum class GclErrorID {
     InvalidDigit,
     InvalidEscape,
     UnknownChar,
+    TypeMismatch,
+    ValueOutOfRange,
+    NestingTooDeep,
+};
+
+// An error kept as data, for reporting it without throwing. The message is
+// only built when asked for.
+struct GclError {
+    GclErrorID errorID;
+    Span span;
+
+    // The character the error is about: the offending one for lexing errors,
+    // the expected one for `ExpectedPunctuaction`.
+    char chr;
+
+    // Base of the number for `InvalidDigit`.
+    int base;
+
+    // The parsed text, which the message is built from.
+    std::string_view text;
+
+    // The string token the error was found at, if it was decoded in place
+    // and so cannot be lexed again from `text`.
+    std::string_view foundString = {};
+
+    // Builds the message that `GclException::info` would hold. Only valid
+    // while the parsed text is.
+    std::string message() const;
 };
 
 class GclException : public std::exception {
 public:
     GclException(GclErrorID errorID, Span span, std::string&& info) :
-        span{span}, info{std::move(info)} {}
+        errorID{errorID}, span{span}, info{std::move(info)} {}
+
+    explicit GclException(GclError const& error) :
+        errorID{error.errorID}, span{error.span}, info{error.message()} {}
 
     inline char const* what() const noexcept {
         return info.c_str();
@@ -0,0 +1,97 @@
+// Copyright 2025 Maicol Castro <maicolcastro.abc@gmail.com>.
+// Distributed under the MIT License.
+// See LICENSE.txt in the root directory of this project
+// or at https://opensource.org/license/mit.
+
+#pragma once
+
+#include <stdexcept>
+#include <utility>
+#include <variant>
+
+namespace gcl {
+
+template<typename E>
+class Unexpected {
+public:
+    explicit Unexpected(E error) : m_error{std::move(error)} {}
+
+    inline E& error() {
+        return m_error;
+    }
+
+    inline E const& error() const {
+        return m_error;
+    }
+
+private:
+    E m_error;
+};
+
+// Either a value or the error that prevented it, like C++23's
+// `std::expected`, which the C++20 this library targets lacks.
+template<typename T, typename E>
+class Expected {
+public:
+    Expected(T&& value) : m_data{std::in_place_index<0>, std::move(value)} {}
+    Expected(Unexpected<E>&& error) : m_data{std::in_place_index<1>, std::move(error.error())} {}
+
+    inline bool hasValue() const {
+        return m_data.index() == 0;
+    }
+
+    inline explicit operator bool() const {
+        return hasValue();
+    }
+
+    inline T& value() {
+        checkValue();
+        return *std::get_if<0>(&m_data);
+    }
+
+    inline T const& value() const {
+        checkValue();
+        return *std::get_if<0>(&m_data);
+    }
+
+    inline E& error() {
+        checkError();
+        return *std::get_if<1>(&m_data);
+    }
+
+    inline E const& error() const {
+        checkError();
+        return *std::get_if<1>(&m_data);
+    }
+
+    inline T& operator *() {
+        return value();
+    }
+
+    inline T const& operator *() const {
+        return value();
+    }
+
+    inline T* operator ->() {
+        return &value();
+    }
+
+    inline T const* operator ->() const {
+        return &value();
+    }
+
+private:
+    std::variant<T, E> m_data;
+
+    inline void checkValue() const {
+        if (!hasValue())
+            throw std::runtime_error("Expected::value() -> holds an error");
+    }
+
+    inline void checkError() const {
+        if (hasValue())
+            throw std::runtime_error("Expected::error() -> holds a value");
+    }
+};
+
+} // namespace gcl
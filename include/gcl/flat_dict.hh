@@ -0,0 +1,177 @@
+// Copyright 2025 Maicol Castro <maicolcastro.abc@gmail.com>.
+// Distributed under the MIT License.
+// See LICENSE.txt in the root directory of this project
+// or at https://opensource.org/license/mit.
+
+#pragma once
+
+#include <algorithm>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "key.hh"
+
+namespace gcl {
+
+// A dict stored as a vector of entries sorted by key.
+//
+// It implements the subset of the `std::map` interface used with `gcl::Dict`,
+// so it can replace it when GCL_FLAT_DICT is defined. Entries are contiguous,
+// lookups are a binary search, and inserting keys in order is an append.
+//
+// Inserting a key out of order moves the entries after it, so a dict built
+// from many keys is instead appended to with `appendUnsorted()` and sorted
+// once with `sortEntries()`, as the parser does.
+//
+// It is a template only so that it can be instantiated with `Value` before
+// that type is complete. `Entries` is the vector that holds the entries.
+template<typename V, typename Entries = std::pmr::vector<std::pair<Key, V>>>
+class BasicFlatDict {
+public:
+    using key_type = Key;
+    using mapped_type = V;
+    using value_type = std::pair<key_type, V>;
+    using allocator_type = std::pmr::polymorphic_allocator<value_type>;
+    using iterator = typename Entries::iterator;
+    using const_iterator = typename Entries::const_iterator;
+    using size_type = size_t;
+
+    BasicFlatDict() = default;
+    explicit BasicFlatDict(allocator_type allocator) : m_entries(allocator) {}
+
+    inline allocator_type get_allocator() const { return m_entries.get_allocator(); }
+
+    inline iterator begin() { return m_entries.begin(); }
+    inline iterator end() { return m_entries.end(); }
+    inline const_iterator begin() const { return m_entries.begin(); }
+    inline const_iterator end() const { return m_entries.end(); }
+
+    inline size_t size() const { return m_entries.size(); }
+    inline bool empty() const { return m_entries.empty(); }
+
+    inline void reserve(size_t capacity) { m_entries.reserve(capacity); }
+    inline void clear() { m_entries.clear(); }
+
+    inline iterator find(std::string_view key) {
+        iterator it = lowerBound(key);
+        return it != end() && it->first == key ? it : end();
+    }
+
+    inline const_iterator find(std::string_view key) const {
+        return const_cast<BasicFlatDict*>(this)->find(key);
+    }
+
+    inline bool contains(std::string_view key) const {
+        return find(key) != end();
+    }
+
+    inline size_t count(std::string_view key) const {
+        return contains(key) ? 1 : 0;
+    }
+
+    inline V& at(std::string_view key) {
+        if (iterator it = find(key); it != end())
+            return it->second;
+
+        throw std::out_of_range("BasicFlatDict::at() -> key not found");
+    }
+
+    inline V const& at(std::string_view key) const {
+        return const_cast<BasicFlatDict*>(this)->at(key);
+    }
+
+    inline V& operator [](std::string_view key) {
+        return try_emplace(key_type(key, m_entries.get_allocator().resource())).first->second;
+    }
+
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(key_type&& key, Args&&... args) {
+        iterator it = lowerBound(key);
+
+        if (it != end() && it->first == key)
+            return { it, false };
+
+        it = m_entries.emplace(it, std::piecewise_construct,
+            std::forward_as_tuple(std::move(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+
+        return { it, true };
+    }
+
+    inline std::pair<iterator, bool> insert(value_type&& entry) {
+        return try_emplace(std::move(entry.first), std::move(entry.second));
+    }
+
+    // Appends an entry without keeping the entries sorted or checking that
+    // the key is new. `sortEntries()` must be called before any other member
+    // that looks up a key.
+    template<typename... Args>
+    inline V& appendUnsorted(key_type&& key, Args&&... args) {
+        return m_entries.emplace_back(std::piecewise_construct,
+            std::forward_as_tuple(std::move(key)), std::forward_as_tuple(std::forward<Args>(args)...)).second;
+    }
+
+    // Sorts the entries by key, keeping the order of equal keys. Returns the
+    // first entry with the same key as the one before it, or `end()` if keys
+    // are unique. Entries already in order are only checked.
+    iterator sortEntries() {
+        auto isNotBefore = [](value_type const& a, value_type const& b) {
+            return !(std::string_view(a.first) < std::string_view(b.first));
+        };
+
+        iterator it = std::adjacent_find(m_entries.begin(), m_entries.end(), isNotBefore);
+
+        if (it == m_entries.end())
+            return it;
+
+        std::stable_sort(m_entries.begin(), m_entries.end(), [](value_type const& a, value_type const& b) {
+            return std::string_view(a.first) < std::string_view(b.first);
+        });
+
+        // Keys interned in one pool are told apart by address.
+        it = std::adjacent_find(m_entries.begin(), m_entries.end(), [](value_type const& a, value_type const& b) {
+            return a.first == b.first;
+        });
+
+        return it != m_entries.end() ? it + 1 : it;
+    }
+
+    // Keeps the first of each run of entries with the same key, once sorted.
+    void eraseDuplicates() {
+        iterator end = std::unique(m_entries.begin(), m_entries.end(), [](value_type const& a, value_type const& b) {
+            return a.first == b.first;
+        });
+
+        m_entries.erase(end, m_entries.end());
+    }
+
+    inline iterator erase(const_iterator it) {
+        return m_entries.erase(it);
+    }
+
+    inline size_t erase(std::string_view key) {
+        if (iterator it = find(key); it != end()) {
+            m_entries.erase(it);
+            return 1;
+        }
+
+        return 0;
+    }
+
+private:
+    Entries m_entries;
+
+    inline iterator lowerBound(std::string_view key) {
+        // Fast path for keys arriving in order, which turns parsing into appends.
+        if (m_entries.empty() || std::string_view(m_entries.back().first) < key)
+            return m_entries.end();
+
+        return std::lower_bound(m_entries.begin(), m_entries.end(), key, [](value_type const& entry, std::string_view key) {
+            return std::string_view(entry.first) < key;
+        });
+    }
+};
+
+} // namespace gcl
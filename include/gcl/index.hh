@@ -0,0 +1,83 @@
+// Copyright 2025 Maicol Castro <maicolcastro.abc@gmail.com>.
+// Distributed under the MIT License.
+// See LICENSE.txt in the root directory of this project
+// or at https://opensource.org/license/mit.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace gcl {
+
+// The offsets of every token in a text, found in one pass over it 64 bytes at
+// a time, as the first stage of a two-stage parse.
+//
+// Each block is classified with vector compares into masks of quotes,
+// backslashes, comment signs, whitespace and punctuaction. Escaped quotes are
+// dropped, and a prefix XOR of the rest, a carry-less multiply where
+// available, masks the strings. A `#` outside them masks a comment up to the
+// newline, and the strings are masked again without the quotes inside it.
+// What is left are the tokens: punctuaction, opening quotes, and the first
+// byte of every other run of characters.
+//
+// A tokenizer given the index then steps from token to token without looking
+// at whitespace or comments, and finds the bracket closing a container
+// without scanning it. It still lexes each token, so the index does not make
+// a full parse faster; it is worth building when containers are stepped
+// over, or when the same text is read more than once.
+class StructuralIndex {
+public:
+    StructuralIndex() : m_chars{nullptr}, m_length{0}, m_tokens(), m_closes() {}
+
+    // Indexes the text, which must outlive the index. Returns false, leaving
+    // the index empty, if the text is over 4 GiB or if it may be read
+    // differently by the tokenizer, which is the case only for a string
+    // that is not closed on its line and for a backslash outside strings and
+    // comments. Both are errors for the tokenizer.
+    bool build(char const* chars, size_t length);
+
+    inline bool build(std::string_view text) {
+        return build(text.data(), text.length());
+    }
+
+    inline void clear() {
+        m_chars = nullptr;
+        m_length = 0;
+        m_tokens.clear();
+        m_closes.clear();
+    }
+
+    inline char const* data() const {
+        return m_chars;
+    }
+
+    inline size_t length() const {
+        return m_length;
+    }
+
+    // The offsets of the tokens, in order.
+    inline std::vector<uint32_t> const& tokens() const {
+        return m_tokens;
+    }
+
+    // The offset of the bracket closing the one at `tokens()[token]`, or
+    // SIZE_MAX if there is none, or if it closes the other kind.
+    inline size_t closeOf(size_t token) const {
+        return m_closes[token] != UINT32_MAX ? m_closes[token] : SIZE_MAX;
+    }
+
+private:
+    char const* m_chars;
+    size_t m_length;
+    std::vector<uint32_t> m_tokens;
+
+    // By token, for opening brackets.
+    std::vector<uint32_t> m_closes;
+
+    void matchBrackets();
+};
+
+} // namespace gcl
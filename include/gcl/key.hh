@@ -0,0 +1,233 @@
+// Copyright 2025 Maicol Castro <maicolcastro.abc@gmail.com>.
+// Distributed under the MIT License.
+// See LICENSE.txt in the root directory of this project
+// or at https://opensource.org/license/mit.
+
+#pragma once
+
+#include <compare>
+#include <cstdint>
+#include <cstring>
+#include <memory_resource>
+#include <string_view>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+
+namespace gcl {
+
+class KeyPool;
+
+// A dict key. Keys are immutable, so equal keys can share one copy of their
+// characters: keys made by a `KeyPool` point into it, and compare to each
+// other by address alone, as the pool stores each text once. Any other key
+// owns a copy allocated from its allocator, and so does every copy of a key.
+// Keys are still ordered by their text.
+class Key {
+public:
+    using allocator_type = std::pmr::polymorphic_allocator<char>;
+
+    constexpr Key() noexcept : m_chars{""}, m_length{0}, m_owner{0} {}
+
+    Key(std::string_view text, allocator_type allocator = {}) : Key() {
+        assign(text, allocator.resource());
+    }
+
+    // From anything that converts to a view, such as a `String`.
+    template<typename T> requires (!std::is_same_v<T, Key> && std::is_convertible_v<T const&, std::string_view>)
+    Key(T const& text, allocator_type allocator = {}) : Key(std::string_view(text), allocator) {}
+
+    Key(Key const& that, allocator_type allocator = {}) : Key() {
+        assign(that.view(), allocator.resource());
+    }
+
+    Key(Key&& that) noexcept : m_chars{that.m_chars}, m_length{that.m_length}, m_owner{that.m_owner} {
+        that.m_chars = "";
+        that.m_length = 0;
+        that.m_owner = 0;
+    }
+
+    // Keys from a pool stay shared, owned ones are only copied if `allocator`
+    // uses another resource.
+    Key(Key&& that, allocator_type allocator) : Key() {
+        if (that.resource() == nullptr || *that.resource() == *allocator.resource())
+            swap(that);
+        else
+            assign(that.view(), allocator.resource());
+    }
+
+    inline ~Key() {
+        release();
+    }
+
+    Key& operator =(Key const& that) {
+        if (this != &that)
+            assign(that.view(), resource() != nullptr ? resource() : std::pmr::get_default_resource());
+
+        return *this;
+    }
+
+    Key& operator =(Key&& that) noexcept {
+        if (this != &that) {
+            release();
+            swap(that);
+        }
+
+        return *this;
+    }
+
+    inline char const* data() const {
+        return m_chars;
+    }
+
+    inline size_t size() const {
+        return m_length;
+    }
+
+    inline size_t length() const {
+        return m_length;
+    }
+
+    inline bool empty() const {
+        return m_length == 0;
+    }
+
+    inline std::string_view view() const {
+        return std::string_view(m_chars, m_length);
+    }
+
+    inline operator std::string_view() const {
+        return view();
+    }
+
+    inline bool isInterned() const {
+        return (m_owner & IS_INTERNED) != 0;
+    }
+
+    friend inline bool operator ==(Key const& a, Key const& b) {
+        if (a.m_chars == b.m_chars && a.m_length == b.m_length)
+            return true;
+
+        // Interned in the same pool, they would share their characters.
+        if (a.isInterned() && a.m_owner == b.m_owner)
+            return false;
+
+        return a.view() == b.view();
+    }
+
+    friend inline std::strong_ordering operator <=>(Key const& a, Key const& b) {
+        if (a.m_chars == b.m_chars && a.m_length == b.m_length)
+            return std::strong_ordering::equal;
+
+        return a.view() <=> b.view();
+    }
+
+    // Templates, so that comparing with a string literal does not convert it
+    // to a `Key` instead.
+    template<typename T> requires (!std::is_same_v<T, Key> && std::is_convertible_v<T const&, std::string_view>)
+    friend inline bool operator ==(Key const& a, T const& b) {
+        return a.view() == std::string_view(b);
+    }
+
+    template<typename T> requires (!std::is_same_v<T, Key> && std::is_convertible_v<T const&, std::string_view>)
+    friend inline std::strong_ordering operator <=>(Key const& a, T const& b) {
+        return a.view() <=> std::string_view(b);
+    }
+
+private:
+    friend class KeyPool;
+
+    // Set in `m_owner` for a key interned in a pool.
+    static constexpr std::uintptr_t IS_INTERNED = 1;
+
+    char const* m_chars;
+    size_t m_length;
+
+    // The address of the resource that owns `m_chars`, or of the pool they
+    // are interned in along with `IS_INTERNED`, or 0 if neither.
+    std::uintptr_t m_owner;
+
+    // The resource that owns `m_chars`, or null if they are not owned.
+    inline std::pmr::memory_resource* resource() const {
+        return isInterned() ? nullptr : reinterpret_cast<std::pmr::memory_resource*>(m_owner);
+    }
+
+    inline void swap(Key& that) noexcept {
+        std::swap(m_chars, that.m_chars);
+        std::swap(m_length, that.m_length);
+        std::swap(m_owner, that.m_owner);
+    }
+
+    inline void release() {
+        if (std::pmr::memory_resource* owner = resource())
+            owner->deallocate(const_cast<char*>(m_chars), m_length, 1);
+
+        m_chars = "";
+        m_length = 0;
+        m_owner = 0;
+    }
+
+    void assign(std::string_view text, std::pmr::memory_resource* resource) {
+        release();
+
+        if (text.empty())
+            return;
+
+        char* chars = static_cast<char*>(resource->allocate(text.length(), 1));
+        std::memcpy(chars, text.data(), text.length());
+
+        m_chars = chars;
+        m_length = text.length();
+        m_owner = reinterpret_cast<std::uintptr_t>(resource);
+    }
+};
+
+// Stores one copy of each distinct key, in blocks taken from `resource`, so
+// that the keys it makes share it. Those are valid until the pool is cleared
+// or destroyed.
+class KeyPool {
+public:
+    explicit KeyPool(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : m_arena(resource), m_keys(&m_arena)
+    {}
+
+    KeyPool(KeyPool const&) = delete;
+    KeyPool& operator =(KeyPool const&) = delete;
+
+    Key intern(std::string_view text) {
+        if (text.empty())
+            return Key();
+
+        auto it = m_keys.find(text);
+
+        if (it == m_keys.end()) {
+            char* chars = static_cast<char*>(m_arena.allocate(text.length(), 1));
+            std::memcpy(chars, text.data(), text.length());
+
+            it = m_keys.insert(std::string_view(chars, text.length())).first;
+        }
+
+        Key key;
+        key.m_chars = it->data();
+        key.m_length = it->length();
+        key.m_owner = reinterpret_cast<std::uintptr_t>(this) | Key::IS_INTERNED;
+
+        return key;
+    }
+
+    inline size_t size() const {
+        return m_keys.size();
+    }
+
+    // Forgets every key and frees their memory.
+    inline void clear() {
+        m_keys = std::pmr::unordered_set<std::string_view>(&m_arena);
+        m_arena.release();
+    }
+
+private:
+    std::pmr::monotonic_buffer_resource m_arena;
+    std::pmr::unordered_set<std::string_view> m_keys;
+};
+
+} // namespace gcl
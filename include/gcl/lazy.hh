@@ -0,0 +1,90 @@
+// Copyright 2025 Maicol Castro <maicolcastro.abc@gmail.com>.
+// Distributed under the MIT License.
+// See LICENSE.txt in the root directory of this project
+// or at https://opensource.org/license/mit.
+
+#pragma once
+
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <string_view>
+#include "value.hh"
+
+namespace gcl {
+
+class LazyDocument;
+
+// A value inside a `LazyDocument`. The children of a container are read the
+// first time one of them, or their count, is asked for; containers among them
+// are only stepped over until they are accessed in turn. Throws
+// `std::runtime_error` on a type mismatch, like `Value`, and `GclException`
+// if the container being read turns out to be malformed.
+class LazyValue {
+public:
+    ValueType type() const;
+
+    bool getBool() const;
+    intptr_t getInt() const;
+    Float getFloat() const;
+    std::string_view getString() const;
+
+    // Element count of an array or entry count of a dict.
+    size_t size() const;
+
+    // Array element at `index`, or dict entry at `index` in key order, like
+    // iterating over a `Dict`.
+    LazyValue at(size_t index) const;
+
+    // Key of the dict entry at `index`, in key order.
+    std::string_view keyAt(size_t index) const;
+
+    // Dict entry named `key`, or nothing if there is none.
+    std::optional<LazyValue> find(std::string_view key) const;
+
+    // Whether the children of this container have been read.
+    bool isLoaded() const;
+
+    // Builds the whole `Value` tree of this value, reading it again from the
+    // text.
+    void decode(Value& output, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) const;
+
+private:
+    friend class LazyDocument;
+
+    struct Node;
+    struct State;
+
+    State* m_state;
+    Node* m_node;
+
+    LazyValue(State* state, Node* node) : m_state{state}, m_node{node} {}
+
+    void expectType(ValueType type, char const* function) const;
+    Node& load() const;
+};
+
+// A document read on demand from a text, which must outlive it. Only the root
+// is read up front, so errors inside a container are only reported once it is
+// accessed. Not safe to access from several threads at once.
+class LazyDocument {
+public:
+    // Throws `GclException` if the text does not start with a valid value,
+    // ignoring what is inside its containers. The root is left undefined if
+    // there is no value at all.
+    LazyDocument(char const* chars, size_t length);
+
+    inline explicit LazyDocument(std::string_view text) : LazyDocument(text.data(), text.length()) {}
+
+    LazyDocument(LazyDocument&&) noexcept;
+    ~LazyDocument();
+
+    LazyDocument& operator =(LazyDocument&&) noexcept;
+
+    LazyValue root();
+
+private:
+    std::unique_ptr<LazyValue::State> m_state;
+};
+
+} // namespace gcl
@@ -0,0 +1,79 @@
+// Copyright 2025 Maicol Castro <maicolcastro.abc@gmail.com>.
+// Distributed under the MIT License.
+// See LICENSE.txt in the root directory of this project
+// or at https://opensource.org/license/mit.
+
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <string_view>
+
+namespace gcl {
+
+// A read-only memory mapping of a whole file.
+class MappedFile {
+public:
+    MappedFile() : m_data{nullptr}, m_size{0}, m_handle{nullptr} {}
+
+    // Throws `std::system_error` if the file cannot be opened or mapped.
+    explicit MappedFile(std::filesystem::path const& path) : MappedFile() {
+        open(path);
+    }
+
+    MappedFile(MappedFile const&) = delete;
+
+    inline MappedFile(MappedFile&& that) noexcept
+        : m_data{that.m_data}, m_size{that.m_size}, m_handle{that.m_handle}
+    {
+        that.m_data = nullptr;
+        that.m_size = 0;
+        that.m_handle = nullptr;
+    }
+
+    inline ~MappedFile() {
+        close();
+    }
+
+    MappedFile& operator =(MappedFile const&) = delete;
+
+    inline MappedFile& operator =(MappedFile&& that) noexcept {
+        if (this != &that) {
+            close();
+
+            m_data = that.m_data;
+            m_size = that.m_size;
+            m_handle = that.m_handle;
+
+            that.m_data = nullptr;
+            that.m_size = 0;
+            that.m_handle = nullptr;
+        }
+
+        return *this;
+    }
+
+    void open(std::filesystem::path const& path);
+    void close() noexcept;
+
+    inline char const* data() const {
+        return m_data;
+    }
+
+    inline size_t size() const {
+        return m_size;
+    }
+
+    inline std::string_view text() const {
+        return std::string_view(m_data, m_size);
+    }
+
+private:
+    char const* m_data;
+    size_t m_size;
+
+    // The file mapping object on Windows, unused elsewhere.
+    void* m_handle;
+};
+
+} // namespace gcl
@@ -9,12 +9,25 @@
 
 namespace gcl {
 
+// Floats are stored as `double` if GCL_DOUBLE is defined.
+#ifdef GCL_DOUBLE
+    using Float = double;
+#else
+    using Float = float;
+#endif
+
+// How deep parsers let containers nest by default.
+inline constexpr size_t DEFAULT_MAX_DEPTH = 1024;
+
 struct Span {
     size_t beginLineNumber = 0;
     size_t beginColumnNumber = 0;
 
     size_t endLineNumber = 0;
     size_t endColumnNumber = 0;
+
+    size_t beginOffset = 0;
+    size_t endOffset = 0;
 };
         
 } // namespace gcl
@@ -5,6 +5,15 @@
 
 #pragma once
 
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <string_view>
+#include "document.hh"
+#include "exception.hh"
+#include "expected.hh"
+#include "index.hh"
+#include "stats.hh"
 #include "value.hh"
 
 namespace gcl {
@@ -15,4 +24,108 @@ inline bool parse(Value& output, std::string_view text) {
     return parse(output, text.data(), text.length());
 }
 
+// Like `parse`, but also fills `stats`, even if it throws. The value is
+// allocated through a resource that counts allocations on their way to the
+// default resource, as it was set at the first such parse.
+bool parse(Value& output, char const* chars, size_t length, ParseStats& stats);
+
+inline bool parse(Value& output, std::string_view text, ParseStats& stats) {
+    return parse(output, text.data(), text.length(), stats);
+}
+
+// Like `parse`, but reports errors without throwing, which is cheaper when
+// many inputs are malformed. The value is undefined if the text does not start
+// with one. The error refers to the text, which must outlive it for its
+// message to be built.
+Expected<Value, GclError> tryParse(char const* chars, size_t length);
+
+inline Expected<Value, GclError> tryParse(std::string_view text) {
+    return tryParse(text.data(), text.length());
+}
+
+// Parses the text of `index`, stepping from token to token of it instead of
+// skipping whitespace and comments. Results and errors are the same as with
+// `parse`. Each token is still lexed, so this is not faster than `parse`; it
+// is for a text whose index is kept anyway, to step over containers.
+bool parse(Value& output, StructuralIndex const& index);
+
+// Replaces the contents of `output`, allocating the whole tree from its arena.
+bool parse(Document& output, char const* chars, size_t length);
+
+inline bool parse(Document& output, std::string_view text) {
+    return parse(output, text.data(), text.length());
+}
+
+// Like `parse`, but decodes escape sequences into `chars` itself instead of
+// copying strings that have them, leaving it garbled. With compact values,
+// long strings also point into `chars`, which must then outlive the value;
+// copies of the value own their strings.
+bool parseInSitu(Value& output, char* chars, size_t length);
+bool parseInSitu(Document& output, char* chars, size_t length);
+
+// Parses the file at `path` straight from a read-only memory mapping of it,
+// without copying it into memory first. Throws `std::system_error` if the
+// file cannot be opened or mapped.
+bool parseFile(Value& output, std::filesystem::path const& path);
+bool parseFile(Document& output, std::filesystem::path const& path);
+
+// Parses a big top-level array or dict on `threadCount` threads, or one per
+// hardware thread if 0. The text is split at the container's top-level commas
+// into slices that are parsed concurrently and stitched together in order.
+// Other and small inputs are parsed sequentially. Results and errors are the
+// same as with `parse`: if any slice fails, the text is parsed again
+// sequentially to report the first error.
+bool parseParallel(Value& output, char const* chars, size_t length, size_t threadCount = 0);
+
+inline bool parseParallel(Value& output, std::string_view text, size_t threadCount = 0) {
+    return parseParallel(output, text.data(), text.length(), threadCount);
+}
+
+// Keeps the parser's state between calls, so that parsing many small
+// documents does not set it up again each time: the tokenizer's scratch
+// buffers, the stack of open containers, and a pool that `value()` is
+// allocated from, which takes the memory of the previous value back.
+class ParserContext {
+public:
+    ParserContext();
+    ~ParserContext();
+
+    ParserContext(ParserContext const&) = delete;
+    ParserContext& operator =(ParserContext const&) = delete;
+
+    // Like `gcl::parse`.
+    bool parse(Value& output, char const* chars, size_t length);
+
+    inline bool parse(Value& output, std::string_view text) {
+        return parse(output, text.data(), text.length());
+    }
+
+    // Parses into `value()`, replacing the previous value. It is left
+    // undefined if the text does not start with a value.
+    bool parse(char const* chars, size_t length);
+
+    inline bool parse(std::string_view text) {
+        return parse(text.data(), text.length());
+    }
+
+    // Valid until the next parse into it, or until the context is destroyed.
+    Value& value();
+
+    // Containers nested deeper than this are reported as
+    // `GclErrorID::NestingTooDeep`. `DEFAULT_MAX_DEPTH` until set.
+    void setMaxDepth(size_t maxDepth);
+
+private:
+    struct State;
+
+    std::unique_ptr<State> m_state;
+};
+
+// Parses `texts[i]` into `outputs[i]` on `threadCount` threads, or one per
+// hardware thread if 0, each with its own `ParserContext`. Outputs of texts
+// that do not start with a value are left undefined. Once the whole batch is
+// done, the exception of its first failed text, if any, is rethrown. Throws
+// `std::invalid_argument` if the spans differ in size.
+void parseBatch(std::span<std::string_view const> texts, std::span<Value> outputs, size_t threadCount = 1);
+
 } // namespace gcl
@@ -0,0 +1,49 @@
+// Copyright 2025 Maicol Castro <maicolcastro.abc@gmail.com>.
+// Distributed under the MIT License.
+// See LICENSE.txt in the root directory of this project
+// or at https://opensource.org/license/mit.
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include "value.hh"
+
+namespace gcl {
+
+// A path to a value nested in dicts and arrays, such as `servers[3].tls.cert`:
+// dict keys separated by dots, and array indices in brackets. The empty path
+// names the root.
+//
+// A path is parsed once and can then be looked up in any number of values.
+class Path {
+public:
+    struct Segment {
+        // Empty for array indices.
+        std::string key;
+        size_t index;
+    };
+
+    Path() = default;
+
+    // Throws `std::runtime_error` if `text` is not a valid path.
+    explicit Path(std::string_view text);
+
+    // The value at the path, or null if a key or index along it is missing or
+    // a value along it has another type. Never throws.
+    Value* find(Value& root) const noexcept;
+
+    inline Value const* find(Value const& root) const noexcept {
+        return find(const_cast<Value&>(root));
+    }
+
+    inline std::vector<Segment> const& segments() const {
+        return m_segments;
+    }
+
+private:
+    std::vector<Segment> m_segments;
+};
+
+} // namespace gcl
@@ -0,0 +1,511 @@
+// Copyright 2025 Maicol Castro <maicolcastro.abc@gmail.com>.
+// Distributed under the MIT License.
+// See LICENSE.txt in the root directory of this project
+// or at https://opensource.org/license/mit.
+
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#include "exception.hh"
+#include "tokenizer.hh"
+#include "value.hh"
+
+namespace gcl {
+
+// Parses a document into a sequence of events sent to `Handler`, without
+// building a `Value` tree. `Handler` must provide:
+//
+//     void onUndefined();
+//     void onNull();
+//     void onBool(bool x);
+//     void onInt(intptr_t x);
+//     void onFloat(Float x);
+//     void onString(std::string_view x);
+//     void onArrayBegin();
+//     void onArrayEnd();
+//     void onDictBegin();
+//     bool onKey(std::string_view key);
+//     void onDictEnd();
+//
+// `onKey` returns false to reject a key that is already defined, which is
+// reported as `GclErrorID::KeyAlreadyDefined`. Views passed to the handler
+// are only valid during the call.
+//
+// Keys can instead be checked once a dict ends, by an `onDictEnd` that
+// returns a `std::string_view`: one of the keys that `onKey` was given for
+// the dict, if it was defined twice, or else an empty view. Keys are views
+// into the text, so the error is reported at that key.
+//
+// If `Handler` also provides
+//
+//     void onError();
+//
+// it is called when a read stops at an error, with containers left open.
+//
+// If `Handler` also provides
+//
+//     void onSkipped(ValueType type, size_t open, size_t close);
+//
+// containers are not read but stepped over by matching their brackets, and
+// reported with the offsets of those instead. A container whose bracket is
+// not matched is read as usual, so that its error is reported.
+//
+// If `Handler` also provides
+//
+//     void onToken(Token const& token);
+//
+// it is told of every token lexed, or attempted on an error.
+//
+// Nested containers are tracked on a stack of the reader rather than by
+// recursion, so their depth is only bounded by `maxDepth()`.
+//
+// Errors are not thrown while reading: reading stops at the first one, which
+// `read()` then throws and `tryRead()` keeps in `error()`.
+template<typename Handler>
+class Reader {
+public:
+    explicit Reader(Handler& handler)
+        : m_handler{handler}, m_tokenizer(), m_containers(), m_maxDepth{DEFAULT_MAX_DEPTH}
+        , m_error(), m_hasError{false}
+    {
+        m_containers.reserve(16);
+    }
+
+    // Returns false, without sending any event, if the text does not start
+    // with a value. Throws `GclException` on an error.
+    bool read(char const* chars, size_t length) {
+        bool isValue = tryRead(chars, length);
+
+        if (m_hasError)
+            throw GclException(m_error);
+
+        return isValue;
+    }
+
+    inline bool read(std::string_view text) {
+        return read(text.data(), text.length());
+    }
+
+    // Like `read()`, but returns false on an error too, which is then kept in
+    // `error()` instead of thrown.
+    bool tryRead(char const* chars, size_t length) {
+        m_hasError = false;
+        m_containers.clear();
+        m_tokenizer.setText(chars, length);
+
+        return finish(advance() && readValue());
+    }
+
+    // Like `read()` with the text of `index`, but steps from token to token
+    // of the index, the first stage of a two-stage parse, instead of skipping
+    // whitespace and comments, and steps over containers without scanning
+    // them. Events and errors are the same.
+    bool read(StructuralIndex const& index) {
+        bool isValue = tryRead(index);
+
+        if (m_hasError)
+            throw GclException(m_error);
+
+        return isValue;
+    }
+
+    bool tryRead(StructuralIndex const& index) {
+        m_hasError = false;
+        m_containers.clear();
+        m_tokenizer.setText(index);
+
+        return finish(advance() && readValue());
+    }
+
+    // Like `read()`, but decodes strings into the text itself, so that every
+    // string event is a view into it and escape sequences cost no copy. The
+    // text is left garbled, but errors read as they would with `read()`.
+    bool readInSitu(char* chars, size_t length) {
+        bool isValue = tryReadInSitu(chars, length);
+
+        if (m_hasError)
+            throw GclException(m_error);
+
+        return isValue;
+    }
+
+    bool tryReadInSitu(char* chars, size_t length) {
+        m_hasError = false;
+        m_containers.clear();
+        m_tokenizer.setTextInSitu(chars, length);
+
+        return finish(advance() && readValue());
+    }
+
+    // Reads the elements of an array, or the entries of a dict, that follow
+    // `begin` up to the comma or closing bracket at `end`, as if they were a
+    // container of their own. A big container can so be read in slices cut at
+    // its top-level commas. Returns false on an error, or if the slice does
+    // not end at `end`.
+    bool readSlice(char const* chars, size_t length, size_t begin, size_t end, bool isDict) {
+        m_hasError = false;
+        m_containers.clear();
+        m_tokenizer.setText(chars, length);
+        m_tokenizer.seek(begin);
+
+        if (!advance())
+            return finish(false);
+
+        bool isAfterValue;
+
+        if (isDict) {
+            m_handler.onDictBegin();
+            m_containers.push_back(ValueType::Dict);
+
+            if (!readItems(end, isAfterValue) || !endDict())
+                return finish(false);
+
+            // Between two commas there must be an entry.
+            return m_tokenizer.token().offset == end && (isAfterValue || isPunctuaction(Punctuaction::Rbrace));
+        }
+
+        m_handler.onArrayBegin();
+        m_containers.push_back(ValueType::Array);
+
+        if (!readItems(end, isAfterValue))
+            return finish(false);
+
+        m_handler.onArrayEnd();
+
+        return m_tokenizer.token().offset == end;
+    }
+
+    // Containers nested deeper than this are reported as
+    // `GclErrorID::NestingTooDeep`.
+    inline void setMaxDepth(size_t maxDepth) {
+        m_maxDepth = maxDepth;
+    }
+
+    inline size_t maxDepth() const {
+        return m_maxDepth;
+    }
+
+    inline bool hasError() const {
+        return m_hasError;
+    }
+
+    inline GclError const& error() const {
+        return m_error;
+    }
+
+    inline Tokenizer& tokenizer() {
+        return m_tokenizer;
+    }
+
+private:
+    Handler& m_handler;
+    Tokenizer m_tokenizer;
+
+    // The open containers, innermost last.
+    std::vector<ValueType> m_containers;
+    size_t m_maxDepth;
+
+    GclError m_error;
+    bool m_hasError;
+
+    bool readValue();
+    bool beginValue(bool& isOpened);
+    bool endDict();
+    bool skipContainer();
+    bool closeContainer();
+    bool readItems(size_t end, bool& isAfterValue);
+
+    inline bool isPunctuaction(Punctuaction punctuaction) const {
+        Token const& token = m_tokenizer.token();
+        return token.kind == TokenKind::Punctuaction && token.data.punctuaction == punctuaction;
+    }
+
+    // Tells the handler of an error, if there was one, and returns whether
+    // the read found a value.
+    inline bool finish(bool isValue) {
+        if constexpr (requires { m_handler.onError(); }) {
+            if (m_hasError)
+                m_handler.onError();
+        }
+
+        return isValue;
+    }
+
+    inline bool advance() {
+        if constexpr (requires { m_handler.onToken(m_tokenizer.token()); }) {
+            bool isLexed = m_tokenizer.tryAdvance();
+            m_handler.onToken(m_tokenizer.token());
+
+            if (isLexed)
+                return true;
+        }
+        else if (m_tokenizer.tryAdvance()) {
+            return true;
+        }
+
+        m_error = m_tokenizer.error();
+        m_hasError = true;
+
+        return false;
+    }
+
+    // Reports an error at the current token, unless one was already reported
+    // while reading it. Always returns false.
+    inline bool fail(GclErrorID errorID, char chr = '\0') {
+        if (!m_hasError) {
+            Token const& token = m_tokenizer.token();
+            m_error = { errorID, m_tokenizer.spanOf(token), chr, 0, m_tokenizer.text() };
+            m_hasError = true;
+
+            if (m_tokenizer.isInSitu() && token.kind == TokenKind::String)
+                m_error.foundString = token.data.string;
+        }
+
+        return false;
+    }
+};
+
+template<typename Handler>
+inline bool read(Handler& handler, char const* chars, size_t length) {
+    Reader<Handler> reader(handler);
+    return reader.read(chars, length);
+}
+
+template<typename Handler>
+inline bool read(Handler& handler, std::string_view text) {
+    return read(handler, text.data(), text.length());
+}
+
+// Returns false if there is no value at the current token, or on an error.
+template<typename Handler>
+bool Reader<Handler>::readValue() {
+    bool isOpened;
+
+    if (!beginValue(isOpened))
+        return false;
+
+    if (!isOpened)
+        return true;
+
+    bool isAfterValue;
+
+    return readItems(SIZE_MAX, isAfterValue) && closeContainer();
+}
+
+// Reads the value at the current token if it is a scalar, or else opens the
+// container it starts and sets `isOpened`. Returns false if there is no value
+// at the current token, or on an error.
+template<typename Handler>
+bool Reader<Handler>::beginValue(bool& isOpened) {
+    Token& token = m_tokenizer.token();
+
+    isOpened = false;
+
+    switch (token.kind) {
+        case TokenKind::Punctuaction:
+            if (token.data.punctuaction == Punctuaction::Lbrace || token.data.punctuaction == Punctuaction::Lsqb) {
+                if constexpr (requires { m_handler.onSkipped(ValueType::Dict, size_t(), size_t()); }) {
+                    if (skipContainer())
+                        return advance();
+                }
+
+                if (m_containers.size() >= m_maxDepth)
+                    return fail(GclErrorID::NestingTooDeep);
+
+                if (token.data.punctuaction == Punctuaction::Lbrace) {
+                    m_handler.onDictBegin();
+                    m_containers.push_back(ValueType::Dict);
+                }
+                else {
+                    m_handler.onArrayBegin();
+                    m_containers.push_back(ValueType::Array);
+                }
+
+                isOpened = true;
+
+                // Eat the left bracket.
+                return advance();
+            }
+
+            // Any other punctuaction is an undefined value, and is left for
+            // the caller to parse.
+            m_handler.onUndefined();
+
+            return true;
+
+        case TokenKind::String:
+            m_handler.onString(token.data.string);
+            break;
+
+        case TokenKind::Int:
+            m_handler.onInt(token.data.i);
+            break;
+
+        case TokenKind::Float:
+            m_handler.onFloat(token.data.f);
+            break;
+
+        case TokenKind::Identifier:
+            if (token.data.identifier == "true")
+                m_handler.onBool(true);
+            else if (token.data.identifier == "false")
+                m_handler.onBool(false);
+            else if (token.data.identifier == "null")
+                m_handler.onNull();
+            else
+                return false;
+
+            break;
+
+        default:
+            return false;
+    }
+
+    return advance();
+}
+
+// Steps over the container at the current token, up to its closing bracket.
+// Returns false if the bracket is not matched.
+template<typename Handler>
+bool Reader<Handler>::skipContainer() {
+    Token const& token = m_tokenizer.token();
+    size_t close = m_tokenizer.findClose(token.offset);
+
+    if (close == SIZE_MAX)
+        return false;
+
+    m_handler.onSkipped(token.data.punctuaction == Punctuaction::Lbrace ? ValueType::Dict : ValueType::Array, token.offset, close);
+    m_tokenizer.seek(close + 1);
+
+    return true;
+}
+
+// Ends the innermost dict, and reports a key defined twice in it if the
+// handler finds one then.
+template<typename Handler>
+bool Reader<Handler>::endDict() {
+    if constexpr (std::is_same_v<decltype(m_handler.onDictEnd()), std::string_view>) {
+        std::string_view duplicate = m_handler.onDictEnd();
+
+        if (duplicate.empty())
+            return true;
+
+        std::string_view text = m_tokenizer.text();
+
+        if (duplicate.data() < text.data() || duplicate.data() + duplicate.length() > text.data() + text.length())
+            return fail(GclErrorID::KeyAlreadyDefined);
+
+        size_t offset = duplicate.data() - text.data();
+        m_error = { GclErrorID::KeyAlreadyDefined, m_tokenizer.spanOf(offset, offset + duplicate.length()), '\0', 0, text };
+        m_hasError = true;
+
+        return false;
+    }
+    else {
+        m_handler.onDictEnd();
+        return true;
+    }
+}
+
+// Closes the innermost container, whose items have been read.
+template<typename Handler>
+bool Reader<Handler>::closeContainer() {
+    if (m_containers.back() == ValueType::Dict) {
+        if (!isPunctuaction(Punctuaction::Rbrace))
+            return fail(GclErrorID::ExpectedPunctuaction, '}');
+
+        if (!endDict())
+            return false;
+    }
+    else {
+        m_handler.onArrayEnd();
+    }
+
+    m_containers.pop_back();
+
+    // Eat the right bracket.
+    return advance();
+}
+
+// Reads the items of the innermost open container, along with all the
+// containers nested in them, up to the token that ends it, which is left for
+// the caller. That is the right square bracket of an array, and the first
+// token that is not a key in a dict. Items are also stopped at when one is
+// followed by the token at `end`, in which case `isAfterValue` is set.
+//
+// Nested containers are kept on `m_containers` instead of the call stack,
+// so that no input can overflow the latter.
+template<typename Handler>
+bool Reader<Handler>::readItems(size_t end, bool& isAfterValue) {
+    Token& token = m_tokenizer.token();
+    size_t depth = m_containers.size();
+
+    isAfterValue = false;
+
+    for (;;) {
+        // At the start of the innermost container, or after a comma. As in
+        // dicts, `]` may follow `[` or a trailing comma, so `[]` is an empty
+        // array rather than an array with one undefined value.
+        bool isDict = m_containers.back() == ValueType::Dict;
+
+        if (isDict ? token.kind == TokenKind::Identifier : !isPunctuaction(Punctuaction::Rsqb)) {
+            if (isDict) {
+                if (!m_handler.onKey(token.data.identifier))
+                    return fail(GclErrorID::KeyAlreadyDefined);
+
+                if (!advance())
+                    return false;
+
+                if (!isPunctuaction(Punctuaction::Colon))
+                    return fail(GclErrorID::ExpectedPunctuaction, ':');
+
+                if (!advance())
+                    return false;
+            }
+
+            bool isOpened;
+
+            if (!beginValue(isOpened))
+                return fail(GclErrorID::ExpectedValue);
+
+            if (isOpened)
+                continue;
+        }
+        else {
+            if (m_containers.size() == depth)
+                return true;
+
+            if (!closeContainer())
+                return false;
+        }
+
+        // After an item, which may have closed any number of containers.
+        for (;;) {
+            if (m_containers.size() == depth && token.offset >= end) {
+                isAfterValue = true;
+                return true;
+            }
+
+            if (isPunctuaction(Punctuaction::Comma)) {
+                if (!advance())
+                    return false;
+
+                break;
+            }
+
+            if (!isPunctuaction(m_containers.back() == ValueType::Dict ? Punctuaction::Rbrace : Punctuaction::Rsqb))
+                return fail(GclErrorID::ExpectedPunctuaction, ',');
+
+            if (m_containers.size() == depth)
+                return true;
+
+            if (!closeContainer())
+                return false;
+        }
+    }
+}
+
+} // namespace gcl
@@ -0,0 +1,126 @@
+// Copyright 2025 Maicol Castro <maicolcastro.abc@gmail.com>.
+// Distributed under the MIT License.
+// See LICENSE.txt in the root directory of this project
+// or at https://opensource.org/license/mit.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include "shared_value.hh"
+#include "value.hh"
+
+namespace gcl {
+
+// Holds the current version of a config that is read by many threads and
+// replaced now and then by one of them.
+//
+// Each version is an immutable `SharedValue`, which is swapped in atomically:
+// readers keep the version they loaded alive for as long as they need it, and
+// a version is freed with its last reader. Writers are serialized with each
+// other. A reader holding a `Cache` only touches shared state when the version
+// changes: otherwise `get()` is a single atomic load, and never waits.
+//
+// Loading a version, through `load()` or a `Cache` that refreshes, is not
+// lock-free: libstdc++ guards `std::atomic<std::shared_ptr>` with a lock, so
+// such a load can wait briefly for a concurrent `store()` to swap its version
+// in, and a writer for the loads in progress.
+class ConfigRegistry {
+    struct Snapshot;
+
+public:
+    // A reader-side handle, which keeps the version it last loaded and only
+    // loads the current one when it has changed. Checking for a change is a
+    // single atomic load, so `get()` fits a hot path. A cache can only be
+    // used by one thread at a time, and must not outlive its registry.
+    class Cache {
+    public:
+        explicit Cache(ConfigRegistry const& registry) : m_registry{&registry}, m_snapshot{registry.loadSnapshot()} {}
+
+        // The current version, valid until the next call that refreshes
+        // the cache.
+        inline Value const& get() {
+            if (m_registry->m_version.load(std::memory_order_acquire) != m_snapshot->version)
+                m_snapshot = m_registry->loadSnapshot();
+
+            return m_snapshot->value.get();
+        }
+
+        // A handle to the version returned by the last `get()`.
+        inline SharedValue const& handle() const {
+            return m_snapshot->value;
+        }
+
+        // Of the version returned by the last `get()`.
+        inline uint64_t version() const {
+            return m_snapshot->version;
+        }
+
+    private:
+        ConfigRegistry const* m_registry;
+        std::shared_ptr<Snapshot const> m_snapshot;
+    };
+
+    // Holds an undefined value, as version 0.
+    ConfigRegistry() : ConfigRegistry(SharedValue(Value())) {}
+
+    explicit ConfigRegistry(SharedValue value)
+        : m_snapshot{std::make_shared<Snapshot const>(std::move(value), 0)},
+          m_version{0},
+          m_storeMutex()
+    {}
+
+    ConfigRegistry(ConfigRegistry const&) = delete;
+    ConfigRegistry& operator =(ConfigRegistry const&) = delete;
+
+    // A handle to the current version. It may wait for a concurrent
+    // `store()`, as described above.
+    inline SharedValue load() const {
+        return loadSnapshot()->value;
+    }
+
+    inline uint64_t version() const {
+        return m_version.load(std::memory_order_acquire);
+    }
+
+    // Makes `value` the current version, and returns its number. An empty
+    // handle is stored as an undefined value.
+    uint64_t store(SharedValue value);
+
+    // Parses `text` into a document and stores it. Throws `GclException` on
+    // an error, keeping the current version.
+    uint64_t reload(char const* chars, size_t length);
+
+    inline uint64_t reload(std::string_view text) {
+        return reload(text.data(), text.length());
+    }
+
+    // Like `reload`, with the text of the file at `path`.
+    uint64_t reloadFile(std::filesystem::path const& path);
+
+private:
+    struct Snapshot {
+        SharedValue value;
+        uint64_t version;
+
+        Snapshot(SharedValue value, uint64_t version) : value{std::move(value)}, version{version} {}
+    };
+
+    std::atomic<std::shared_ptr<Snapshot const>> m_snapshot;
+
+    // Of `m_snapshot`, stored after it, so that a cache that sees a new
+    // version also finds its snapshot.
+    std::atomic<uint64_t> m_version;
+
+    std::mutex m_storeMutex;
+
+    inline std::shared_ptr<Snapshot const> loadSnapshot() const {
+        return m_snapshot.load(std::memory_order_acquire);
+    }
+};
+
+} // namespace gcl
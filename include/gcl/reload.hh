@@ -0,0 +1,90 @@
+// Copyright 2025 Maicol Castro <maicolcastro.abc@gmail.com>.
+// Distributed under the MIT License.
+// See LICENSE.txt in the root directory of this project
+// or at https://opensource.org/license/mit.
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "value.hh"
+
+namespace gcl {
+
+enum class ChangeKind {
+    Added,
+    Removed,
+    Changed,
+};
+
+struct Change {
+    ChangeKind kind;
+
+    // Of the value, as accepted by `Path`, or empty for the root.
+    std::string path;
+};
+
+// Appends the changes that turn `before` into `after`, as deep as both have
+// containers of the same type. An undefined value counts as no value. Floats
+// only differ if they are different numbers, so NaNs are equal.
+void diff(Value const& before, Value const& after, std::vector<Change>& changes);
+
+// Keeps a value parsed from a text that is replaced now and then by a
+// slightly modified version of itself, such as a pushed config.
+//
+// If the text is a dict, its entries are told apart by their text: entries
+// whose text is unchanged since the last reload keep their value without
+// being parsed again, and only the others are parsed and compared. Cutting
+// and hashing the text is still linear, but parsing and allocating scale with
+// the change instead of the document. Other texts are parsed whole.
+class Reloader {
+public:
+    Reloader() : m_root(), m_entries(), m_generation{0} {}
+
+    // Replaces the value with the one in `text`, and appends the changes
+    // from the previous one to `changes`, removals last. The first reload
+    // adds the root. Throws `GclException` on an error, keeping the previous
+    // value.
+    bool reload(char const* chars, size_t length, std::vector<Change>& changes);
+
+    inline bool reload(std::string_view text, std::vector<Change>& changes) {
+        return reload(text.data(), text.length(), changes);
+    }
+
+    // Valid until the next reload.
+    inline Value const& root() const {
+        return m_root;
+    }
+
+private:
+    struct EntryInfo {
+        std::string key;
+
+        // Of the last reload that found the entry.
+        uint64_t generation;
+    };
+
+    struct TextHash {
+        using is_transparent = void;
+
+        inline size_t operator ()(std::string_view text) const {
+            return std::hash<std::string_view>()(text);
+        }
+    };
+
+    // With the default resource, so that replaced entries are freed.
+    Value m_root;
+
+    // The entries of the root, by their text, if it is a dict.
+    std::unordered_map<std::string, EntryInfo, TextHash, std::equal_to<>> m_entries;
+
+    uint64_t m_generation;
+
+    bool reloadWhole(char const* chars, size_t length, std::vector<Change>& changes);
+};
+
+} // namespace gcl
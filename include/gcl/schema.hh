@@ -0,0 +1,223 @@
+// Copyright 2025 Maicol Castro <maicolcastro.abc@gmail.com>.
+// Distributed under the MIT License.
+// See LICENSE.txt in the root directory of this project
+// or at https://opensource.org/license/mit.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "misc.hh"
+#include "tokenizer.hh"
+#include "value.hh"
+
+namespace gcl {
+
+enum class ViolationKind {
+    TypeMismatch,
+    OutOfRange,
+    MissingKey,
+    UnknownKey,
+};
+
+struct Violation {
+    ViolationKind kind;
+
+    // Of the value, as accepted by `Path`, or empty for the root. For
+    // `MissingKey`, of the missing entry.
+    std::string path;
+
+    // Of the value, or of the dict for `MissingKey`, or of the key for
+    // `UnknownKey`. Left empty when checking a `Value`, which has no text.
+    Span span;
+};
+
+// The expected shape of a value, written in GCL itself:
+//
+//     {
+//         type: "dict",
+//         keys: {
+//             port: { type: "int", min: 1, max: 65535 },
+//             hosts: { type: "array", elements: "string" },
+//             timeout: { type: "number", min: 0, optional: true },
+//         },
+//     }
+//
+// - `type` is a type name or an array of them: "undefined", "null", "bool",
+//   "int", "float", "number" (int or float), "string", "array", "dict" or
+//   "any", the default. A schema can also be just a type name.
+// - `min` and `max` bound numbers, inclusively.
+// - `elements` is the schema of every element of an array.
+// - `keys` are the schemas of the entries of a dict, which are required
+//   unless marked `optional: true`.
+// - `others` is the schema of the entries not in `keys`. Without it, those
+//   are violations if `keys` is given, and unchecked otherwise.
+//
+// A schema is compiled once into a flat table of nodes, with the keys of each
+// dict sorted for a binary search, and can then check any number of values.
+class Schema {
+public:
+    // Accepts any value.
+    Schema();
+
+    // Throws `std::runtime_error` if `schema` is not a valid schema.
+    explicit Schema(Value const& schema);
+
+    // Like the above, with the schema parsed from `text`. Throws
+    // `GclException` if the text is not valid GCL.
+    explicit Schema(std::string_view text);
+
+    inline explicit Schema(char const* text) : Schema(std::string_view(text)) {}
+
+    // Appends the violations of `value` to `violations`, and returns whether
+    // there were none.
+    bool check(Value const& value, std::vector<Violation>& violations) const;
+
+    // Like the above, but checks the text as it is parsed, without building
+    // a value. A text without a value is checked as an undefined value.
+    // Throws `GclException` if the text is not valid GCL.
+    bool check(char const* chars, size_t length, std::vector<Violation>& violations) const;
+
+    inline bool check(std::string_view text, std::vector<Violation>& violations) const {
+        return check(text.data(), text.length(), violations);
+    }
+
+private:
+    friend class SchemaChecker;
+
+    struct Bound {
+        bool isSet;
+        bool isInt;
+        intptr_t i;
+        double f;
+    };
+
+    struct Node {
+        // A bit for each `ValueType` the value may have.
+        uint32_t types;
+
+        Bound min;
+        Bound max;
+
+        // Of the node for array elements.
+        uint32_t elements;
+
+        // The range of the dict keys in `m_keys`.
+        uint32_t keysBegin;
+        uint32_t keysEnd;
+
+        // Of the node for the entries not in the range, or `REJECT`.
+        uint32_t others;
+
+        uint32_t requiredCount;
+    };
+
+    struct KeyNode {
+        std::string key;
+        uint32_t node;
+        bool isRequired;
+    };
+
+    // Nodes never refer to the root, so its index marks undeclared keys as
+    // violations.
+    static constexpr uint32_t REJECT = 1;
+
+    // The first node accepts any value, and the second is the root.
+    std::vector<Node> m_nodes;
+    std::vector<KeyNode> m_keys;
+
+    uint32_t compile(Value const& schema, std::string const& path);
+};
+
+// Checks reader events against a schema, so it can be given to `Reader` to
+// check a text while it is parsed, or to `walk()` to check a value. Each
+// violation is reported where it is found, and checking goes on, so a single
+// pass reports all of them.
+//
+// Keys of the schema defined twice in the same dict are rejected, as
+// `Reader` expects of `onKey`. Other keys are not tracked.
+//
+// A checker can be reused for any number of values, keeping the capacity of
+// its stacks.
+class SchemaChecker {
+public:
+    explicit SchemaChecker(Schema const& schema, std::vector<Violation>& violations)
+        : m_schema{&schema}, m_violations{&violations}, m_tokenizer{nullptr}, m_frames(), m_seen(), m_next{0}
+    {
+        m_frames.reserve(16);
+    }
+
+    // Starts checking a new value, and gives spans to its violations from
+    // the current token of `tokenizer`, if not null.
+    inline void reset(Tokenizer* tokenizer) {
+        m_tokenizer = tokenizer;
+        m_frames.clear();
+        m_seen.clear();
+        m_next = 0;
+    }
+
+    void onUndefined();
+    void onNull();
+    void onBool(bool x);
+    void onInt(intptr_t x);
+    void onFloat(Float x);
+    void onString(std::string_view x);
+    void onArrayBegin();
+    void onArrayEnd();
+    void onDictBegin();
+    bool onKey(std::string_view key);
+    void onDictEnd();
+
+private:
+    struct Frame {
+        // Of the container.
+        uint32_t node;
+
+        // Whether the value is a dict.
+        bool isDict;
+
+        // Whether `otherKey` holds the current key, rather than `key`.
+        bool isOtherKey;
+
+        // The count of elements read, for arrays.
+        size_t count;
+
+        // The current key, for dicts.
+        std::string_view key;
+        std::string otherKey;
+
+        // Of the required keys read, and of the flags in `m_seen` for every
+        // key of the node.
+        uint32_t requiredCount;
+        size_t seenBegin;
+
+        // Of the opening bracket.
+        size_t open;
+    };
+
+    Schema const* m_schema;
+    std::vector<Violation>* m_violations;
+    Tokenizer* m_tokenizer;
+
+    // The open containers, innermost last.
+    std::vector<Frame> m_frames;
+
+    // Whether each key of the open dicts was read.
+    std::vector<bool> m_seen;
+
+    // Of the node for the next value inside a dict.
+    uint32_t m_next;
+
+    uint32_t beginValue(ValueType type);
+    void beginContainer(ValueType type);
+    void report(ViolationKind kind, std::string&& path, Span span);
+    std::string path(size_t depth) const;
+
+    inline Span currentSpan() {
+        return m_tokenizer != nullptr ? m_tokenizer->spanOf(m_tokenizer->token()) : Span();
+    }
+};
+
+} // namespace gcl
@@ -0,0 +1,58 @@
+// Copyright 2025 Maicol Castro <maicolcastro.abc@gmail.com>.
+// Distributed under the MIT License.
+// See LICENSE.txt in the root directory of this project
+// or at https://opensource.org/license/mit.
+
+#pragma once
+
+#include <ostream>
+#include <string>
+#include "value.hh"
+
+namespace gcl {
+
+class ISink {
+public:
+    virtual void write(char const* chars, size_t length) = 0;
+};
+
+class StringSink final : public ISink {
+public:
+    explicit StringSink(std::string& output) : output{output} {}
+
+    void write(char const* chars, size_t length) override {
+        output.append(chars, length);
+    }
+
+    std::string& output;
+};
+
+class StreamSink final : public ISink {
+public:
+    explicit StreamSink(std::ostream& stream) : stream{stream} {}
+
+    void write(char const* chars, size_t length) override {
+        stream.write(chars, static_cast<std::streamsize>(length));
+    }
+
+    std::ostream& stream;
+};
+
+struct SerializeOptions {
+    // One entry per line, indented by `tabSize` spaces per level, instead of
+    // all on one line without spaces.
+    bool pretty = false;
+    size_t tabSize = 4;
+};
+
+// Writes `value` as GCL text that `gcl::parse` reads back. Output is built in
+// a buffer and handed to the sink in large blocks.
+//
+// Undefined values and floats that are not finite have no literal and are
+// written as `null`. Throws `std::runtime_error` if a dict key is not an
+// identifier.
+void serialize(Value const& value, ISink& sink, SerializeOptions const& options = {});
+
+std::string serialize(Value const& value, SerializeOptions const& options = {});
+
+} // namespace gcl
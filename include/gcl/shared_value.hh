@@ -0,0 +1,101 @@
+// Copyright 2025 Maicol Castro <maicolcastro.abc@gmail.com>.
+// Distributed under the MIT License.
+// See LICENSE.txt in the root directory of this project
+// or at https://opensource.org/license/mit.
+
+#pragma once
+
+#include <memory>
+#include <utility>
+#include "document.hh"
+#include "path.hh"
+#include "value.hh"
+
+namespace gcl {
+
+// A reference-counted handle to an immutable value tree, so that many
+// threads can read one tree without copying or locking it. Copying a handle
+// only increments an atomic count.
+//
+// A handle can also point to a part of a tree, which keeps the whole tree
+// alive. `mutate()` copies the value the handle points to, unless nothing
+// else can see it. Like `std::shared_ptr`, different handles can be used from
+// different threads, but one handle cannot be.
+class SharedValue {
+public:
+    // An empty handle.
+    SharedValue() : m_value(), m_isOwned{false} {}
+
+    explicit SharedValue(Value&& value) : m_value{std::make_shared<Value>(std::move(value))}, m_isOwned{true} {}
+
+    // Takes over the document, which is freed with the last handle to any
+    // part of its tree.
+    explicit SharedValue(Document&& document) : m_isOwned{false} {
+        auto owner = std::make_shared<Document>(std::move(document));
+        m_value = std::shared_ptr<Value>(owner, &owner->root());
+    }
+
+    inline explicit operator bool() const {
+        return m_value != nullptr;
+    }
+
+    inline Value const& get() const {
+        return *m_value;
+    }
+
+    inline Value const& operator *() const {
+        return *m_value;
+    }
+
+    inline Value const* operator ->() const {
+        return m_value.get();
+    }
+
+    // A handle to `part`, which must be inside the value of this one.
+    inline SharedValue share(Value const& part) const {
+        return SharedValue(std::shared_ptr<Value>(m_value, const_cast<Value*>(&part)), false);
+    }
+
+    // A handle to the value at `path`, or an empty handle if there is none.
+    inline SharedValue find(Path const& path) const {
+        Value const* part = m_value != nullptr ? path.find(*m_value) : nullptr;
+        return part != nullptr ? share(*part) : SharedValue();
+    }
+
+    // Whether this is the only handle to its tree.
+    inline bool isUnique() const {
+        return m_value.use_count() == 1;
+    }
+
+    // The value, to be modified. It is first copied, with the default
+    // resource, if other handles can see it or if it is part of a document
+    // or of a bigger tree; later calls then return the copy.
+    Value& mutate() {
+        if (m_value == nullptr) {
+            m_value = std::make_shared<Value>();
+            m_isOwned = true;
+        }
+        else if (!m_isOwned || m_value.use_count() != 1) {
+            m_value = std::make_shared<Value>(*m_value);
+            m_isOwned = true;
+        }
+
+        return *m_value;
+    }
+
+    inline void reset() {
+        m_value.reset();
+        m_isOwned = false;
+    }
+
+private:
+    std::shared_ptr<Value> m_value;
+
+    // Whether `m_value` is a whole tree allocated by the handle itself, which
+    // can be modified in place once no other handle shares it.
+    bool m_isOwned;
+
+    SharedValue(std::shared_ptr<Value> value, bool isOwned) : m_value{std::move(value)}, m_isOwned{isOwned} {}
+};
+
+} // namespace gcl
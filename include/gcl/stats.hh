@@ -0,0 +1,57 @@
+// Copyright 2025 Maicol Castro <maicolcastro.abc@gmail.com>.
+// Distributed under the MIT License.
+// See LICENSE.txt in the root directory of this project
+// or at https://opensource.org/license/mit.
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include "tokenizer.hh"
+
+namespace gcl {
+
+// What one parse did and where its time went, filled by the `gcl::parse`
+// overload that takes it. Parses without one record nothing.
+struct ParseStats {
+    using Duration = std::chrono::nanoseconds;
+
+    // Indexed by `TokenKind`, including the token after the value.
+    std::array<size_t, 6> tokenCounts{};
+
+    // The most containers open at once: 0 for a scalar, 1 for a flat array.
+    size_t maxDepth = 0;
+
+    // Up to the end of the last token lexed.
+    size_t bytesScanned = 0;
+
+    size_t allocationCount = 0;
+    size_t allocatedBytes = 0;
+
+    // Spent lexing tokens. No clock is read per token: the tokens are lexed
+    // again on their own once the parse is done, which is timed as a whole
+    // and not counted in `totalTime`.
+    Duration tokenizeTime{};
+    // Spent building the new value, mostly inserting into containers: the
+    // rest of `totalTime`.
+    Duration buildTime{};
+    // Spent destroying the previous value of the output.
+    Duration destroyTime{};
+    Duration totalTime{};
+
+    inline size_t tokenCount(TokenKind kind) const {
+        return tokenCounts[static_cast<size_t>(kind)];
+    }
+
+    inline size_t totalTokenCount() const {
+        size_t count = 0;
+
+        for (size_t each : tokenCounts)
+            count += each;
+
+        return count;
+    }
+};
+
+} // namespace gcl
@@ -0,0 +1,130 @@
+// Copyright 2025 Maicol Castro <maicolcastro.abc@gmail.com>.
+// Distributed under the MIT License.
+// See LICENSE.txt in the root directory of this project
+// or at https://opensource.org/license/mit.
+
+#pragma once
+
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "misc.hh"
+#include "value.hh"
+
+namespace gcl {
+
+class Token;
+class Tokenizer;
+
+// Parses a document that arrives in chunks.
+//
+// Each call to `feed()` parses every token that is known to be complete and
+// keeps only the unconsumed tail of the input, so a token, comment or nested
+// array or dict can span any number of chunks. `finish()` parses the rest and
+// returns what `gcl::parse` would have returned for the whole input. Errors
+// are thrown as `GclException`s, with spans relative to the whole input.
+//
+// A token cut at the end of a chunk is kept and lexed again only once a chunk
+// that may end it arrives, and that is found by scanning each chunk once, so
+// long tokens cost linear time however they are split. Comments are dropped
+// as they are read.
+class StreamParser {
+public:
+    explicit StreamParser(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+    ~StreamParser();
+
+    StreamParser(StreamParser const&) = delete;
+    StreamParser& operator =(StreamParser const&) = delete;
+
+    void feed(char const* chars, size_t length);
+
+    inline void feed(std::string_view chunk) {
+        feed(chunk.data(), chunk.length());
+    }
+
+    bool finish();
+
+    // Discards all state, so that a new document can be fed.
+    void reset();
+
+    // The parsed value. Only complete once `finish()` returned true.
+    inline Value& value() {
+        return m_value;
+    }
+
+    // Containers nested deeper than this are reported as
+    // `GclErrorID::NestingTooDeep`. `DEFAULT_MAX_DEPTH` until set.
+    inline void setMaxDepth(size_t maxDepth) {
+        m_maxDepth = maxDepth;
+    }
+
+private:
+    enum class State {
+        ExpectRoot,
+        ExpectValue,
+        ExpectSeparator,
+        ExpectKey,
+        ExpectColon,
+        ExpectTrailing,
+        Done,
+    };
+
+    // What the end of the buffer is in the middle of.
+    enum class Cut {
+        None,
+        Comment,
+        String,
+        Other,
+    };
+
+    enum class ValueStart {
+        None,
+        Scalar,
+        Implicit,
+        Container,
+    };
+
+    struct Frame {
+        Value value;
+        State state;
+
+        // Entry of a dict whose value is being parsed.
+        Value* slot;
+    };
+
+    std::pmr::memory_resource* m_resource;
+    std::unique_ptr<Tokenizer> m_tokenizer;
+    std::string m_buffer;
+    std::vector<Frame> m_frames;
+    size_t m_maxDepth;
+    State m_state;
+    Value m_value;
+    bool m_hasValue;
+
+    // The token at the start of the buffer runs to its end, unless `m_cut`
+    // is `Cut::None`. `m_scanned` bytes of it are known not to end it, and
+    // `m_isEscaped` tells whether the next byte is escaped, in a string.
+    Cut m_cut;
+    size_t m_scanned;
+    bool m_isEscaped;
+
+    // Position of the start of `m_buffer` in the whole input, used to make
+    // error spans absolute.
+    size_t m_origin;
+    size_t m_originNewlines;
+    size_t m_originLastNewline;
+
+    void drain(bool isLast);
+    void keepCut(size_t consumed);
+    bool isCutEnded();
+    bool consume(Token const& token);
+    ValueStart beginValue(Token const& token, Value& output);
+    void completeValue(Value&& value);
+    void discard(size_t length);
+    Span absoluteSpan(Span span) const;
+    void resolvePosition(size_t offset, size_t& lineNumber, size_t& columnNumber) const;
+};
+
+} // namespace gcl
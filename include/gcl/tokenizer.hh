@@ -0,0 +1,228 @@
+// Copyright 2025 Maicol Castro <maicolcastro.abc@gmail.com>.
+// Distributed under the MIT License.
+// See LICENSE.txt in the root directory of this project
+// or at https://opensource.org/license/mit.
+
+#pragma once
+
+#include <cstdint>
+#include <format>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "exception.hh"
+#include "misc.hh"
+
+namespace gcl {
+
+class StructuralIndex;
+
+enum class TokenKind {
+    Eof,
+    Int,
+    Float,
+    Identifier,
+    String,
+    Punctuaction,
+};
+
+enum class Punctuaction {
+    Lbrace,
+    Rbrace,
+    Lsqb,
+    Rsqb,
+    Comma,
+    Colon,
+};
+
+// Identifiers and strings are views into the tokenizer input, except for
+// strings containing escape sequences, which are decoded into a scratch
+// buffer owned by the tokenizer. Either way they are only valid until the
+// next call to `Tokenizer::advance()`.
+union TokenData {
+    constexpr TokenData() : i{0} {}
+
+    uintptr_t i;
+    Float f;
+    std::string_view identifier;
+    std::string_view string;
+    Punctuaction punctuaction;
+};
+
+// Tokens only record where they are in the input. Line and column numbers
+// are resolved by `Tokenizer::spanOf()` when they are actually needed.
+class Token {
+public:
+    size_t offset;
+    size_t length;
+    TokenKind kind;
+    TokenData data;
+
+    constexpr Token() : offset{0}, length{0}, kind{TokenKind::Eof} {}
+
+    inline void reset() {
+        kind = TokenKind::Eof;
+        offset = 0;
+        length = 0;
+    }
+};
+
+class Tokenizer {
+public:
+    Tokenizer()
+        : m_chars{}, m_length{0}, m_index{0}
+        , m_char{'\0'}, m_token(), m_scratch(), m_inSituChars{nullptr}
+        , m_newlines(), m_decodedNewlines(), m_hasNewlineIndex{false}
+        , m_structuralIndex{nullptr}, m_nextToken{0}
+        , m_error(), m_hasError{false}
+    {}
+
+    inline void setText(char const* chars, size_t length) {
+        m_chars = chars;
+        m_length = length;
+        m_index = 0;
+        m_char = length > 0 ? m_chars[0] : '\0';
+        m_token.reset();
+        m_inSituChars = nullptr;
+        m_decodedNewlines.clear();
+        m_hasNewlineIndex = false;
+        m_structuralIndex = nullptr;
+        m_nextToken = 0;
+    }
+
+    // Like `setText()` with the text of `index`, but steps from token to
+    // token of the index instead of skipping whitespace and comments, and
+    // finds closing brackets in it. Tokens are lexed as usual.
+    void setText(StructuralIndex const& index);
+
+    // Like `setText()`, but strings with escape sequences are decoded into
+    // the text itself, over their escaped form, instead of into a buffer of
+    // the tokenizer. All strings are then views into the text, valid for as
+    // long as it is, but the text is left garbled.
+    inline void setTextInSitu(char* chars, size_t length) {
+        setText(chars, length);
+        m_inSituChars = chars;
+    }
+
+    inline void reset() {
+        seek(0);
+    }
+
+    // Continues lexing from `index` of the text.
+    inline void seek(size_t index) {
+        m_index = index < m_length ? index : m_length;
+        m_char = m_index < m_length ? m_chars[m_index] : '\0';
+        m_token.reset();
+
+        if (m_structuralIndex != nullptr)
+            seekToken();
+    }
+
+    inline Token& token() {
+        return m_token;
+    }
+
+    inline Token const& token() const {
+        return m_token;
+    }
+
+    inline std::string_view text() const {
+        return std::string_view(m_chars, m_length);
+    }
+
+    // Lexes the next token and returns false at the end of the text. Throws
+    // `GclException` on a lexing error.
+    bool advance();
+
+    // Lexes the next token, but returns false on a lexing error instead of
+    // throwing it, and keeps it in `error()`.
+    bool tryAdvance();
+
+    inline bool hasError() const {
+        return m_hasError;
+    }
+
+    inline bool isInSitu() const {
+        return m_inSituChars != nullptr;
+    }
+
+    inline GclError const& error() const {
+        return m_error;
+    }
+
+    inline bool isAtEnd() const {
+        return m_index >= m_length;
+    }
+
+    // Resolves the byte range `[begin, end)` of the input to line and column
+    // numbers. The first call builds an index of the newlines in the input.
+    Span spanOf(size_t begin, size_t end);
+
+    inline Span spanOf(Token const& token) {
+        return spanOf(token.offset, token.offset + token.length);
+    }
+
+    // Finds the bracket that closes the one at `open` by counting brackets,
+    // stepping over strings and comments without lexing anything else.
+    // Returns SIZE_MAX if there is none, or if it closes the other kind.
+    size_t findClose(size_t open) const;
+
+private:
+    char const* m_chars;
+    size_t m_length;
+    size_t m_index;
+    char m_char;
+    Token m_token;
+    std::string m_scratch;
+
+    // The text, if strings are decoded in it.
+    char* m_inSituChars;
+
+    std::vector<size_t> m_newlines;
+
+    // Offsets of the newlines that escape sequences were decoded to in situ.
+    std::vector<size_t> m_decodedNewlines;
+
+    bool m_hasNewlineIndex;
+
+    StructuralIndex const* m_structuralIndex;
+
+    // Of the token of the index after the current one.
+    size_t m_nextToken;
+
+    GclError m_error;
+    bool m_hasError;
+
+    bool advanceChar();
+    void advanceTo(size_t index);
+    void skipWhitespace();
+    void skipComment();
+    void skipToToken();
+    void seekToken();
+    void readIdentifier();
+    void readNumber();
+    void readDecimal(size_t begin, bool isNeg);
+    bool checkNumberEnd(int base);
+    void readPunctuaction();
+    void readString();
+    void readMisc();
+    void fail(GclErrorID errorID, char chr, int base = 0);
+    void resolvePosition(size_t offset, size_t& lineNumber, size_t& columnNumber);
+};
+
+} // namespace gcl
+
+template<>
+struct std::formatter<gcl::TokenKind> : std::formatter<char const*> {
+    std::format_context::iterator format(gcl::TokenKind kind, std::format_context& context) const;
+};
+
+template<>
+struct std::formatter<gcl::Punctuaction> : std::formatter<char const*> {
+    std::format_context::iterator format(gcl::Punctuaction punctuaction, std::format_context& context) const;
+};
+
+template<>
+struct std::formatter<gcl::Token> : std::formatter<char const*> {
+    std::format_context::iterator format(gcl::Token const& token, std::format_context& context) const;
+};
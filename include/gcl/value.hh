@@ -7,17 +7,45 @@
 
 #include <cstdint>
 #include <map>
+#include <memory_resource>
+#include <new>
 #include <stdexcept>
 #include <string>
 #include <vector>
 
+#include "key.hh"
+#include "misc.hh"
+
+#ifdef GCL_COMPACT_VALUE
+    #include "compact.hh"
+    #include "flat_dict.hh"
+#elif defined(GCL_FLAT_DICT)
+    #include "flat_dict.hh"
+#endif
+
 namespace gcl {
 
 class Value;
 
-using String = std::string;
-using Array = std::vector<Value>;
-using Dict = std::map<std::string, Value>;
+// The containers use polymorphic allocators so that a `Document` can place a
+// whole tree in its arena. Values built by hand use the default resource.
+//
+// GCL_COMPACT_VALUE swaps them for containers of 24 bytes, with short strings
+// stored inline, which halves the size of a `Value` at the cost of strings
+// that cannot be modified in place. Dicts are then always flat.
+#ifdef GCL_COMPACT_VALUE
+    using String = CompactString;
+    using Array = CompactVector<Value>;
+    using Dict = BasicFlatDict<Value, CompactVector<std::pair<Key, Value>>>;
+#else
+    using String = std::pmr::string;
+    using Array = std::pmr::vector<Value>;
+    #ifdef GCL_FLAT_DICT
+        using Dict = BasicFlatDict<Value>;
+    #else
+        using Dict = std::pmr::map<Key, Value, std::less<>>;
+    #endif
+#endif
 
 enum class ValueType {
     Undefined,
@@ -36,7 +64,7 @@ union ValueData {
 
     bool b;
     intptr_t i;
-    float f;
+    Float f;
     String string;
     Array array;
     Dict dict;
@@ -48,7 +76,7 @@ public:
     virtual void visit(std::nullptr_t) = 0;
     virtual void visit(bool x) = 0;
     virtual void visit(intptr_t x) = 0;
-    virtual void visit(float x) = 0;
+    virtual void visit(Float x) = 0;
     virtual void visit(String const& x) = 0;
     virtual void visit(Array const& x) = 0;
     virtual void visit(Dict const& x) = 0;
@@ -70,7 +98,7 @@ public:
         data.i = x;
     }
 
-    inline Value(float x) : type{ValueType::Float} {
+    inline Value(Float x) : type{ValueType::Float} {
         data.f = x;
     }
 
@@ -90,7 +118,7 @@ public:
         that.copyDataTo(data);
     }
 
-    inline Value(Value&& that) : type{that.type} {
+    inline Value(Value&& that) noexcept : type{that.type} {
         that.moveDataTo(data);
         that.type = ValueType::Undefined;
     }
@@ -117,7 +145,7 @@ public:
         return *this;
     }
 
-    inline Value& operator =(Value&& that) {
+    inline Value& operator =(Value&& that) noexcept {
         if (type != ValueType::Undefined)
             releaseData();
 
@@ -146,7 +174,7 @@ public:
         return data.i;
     }
 
-    inline float getFloat() {
+    inline Float getFloat() {
         if (type != ValueType::Float)
             throw std::runtime_error("Value::getFloat() -> type mismatch");
 
@@ -211,6 +239,13 @@ public:
     }
 
 private:
+    // Containers nested up to this deep in the one being destroyed are
+    // destroyed by their destructors, which recurse, and deeper ones with an
+    // explicit stack, which costs an extra pass over them.
+    static constexpr size_t MAX_RECURSIVE_RELEASE_DEPTH = 32;
+
+    static inline thread_local size_t releaseDepth = 0;
+
     void copyDataTo(ValueData& dest) const {
         switch (type) {
             case ValueType::Bool:
@@ -243,7 +278,7 @@ private:
         }
     }
 
-    void moveDataTo(ValueData& dest) {
+    void moveDataTo(ValueData& dest) noexcept {
         switch (type) {
             case ValueType::Bool:
                 dest.b = data.b;
@@ -282,17 +317,75 @@ private:
                 break;
 
             case ValueType::Array:
-                data.array.~Array();
-                break;
-
             case ValueType::Dict:
-                data.dict.~Dict();
+                if (releaseDepth < MAX_RECURSIVE_RELEASE_DEPTH) {
+                    ++releaseDepth;
+                    releaseContainer();
+                    --releaseDepth;
+                }
+                else {
+                    releaseTree();
+                }
+
                 break;
 
             default:
                 break;
         }
     }
+
+    // Destroys a container without recursing into the containers in it,
+    // which are moved out onto a stack first and destroyed from there the
+    // same way, so that no tree is too deep to destroy.
+    void releaseTree() {
+        std::vector<Value> nested;
+
+        moveNestedTo(nested);
+        releaseContainer();
+
+        while (!nested.empty()) {
+            // Moved by type, so that the compiler sees which container of
+            // the union is set; only containers are on the stack.
+            Value& back = nested.back();
+            Value value = back.type == ValueType::Array ? Value(std::move(back.data.array)) : Value(std::move(back.data.dict));
+            nested.pop_back();
+
+            value.moveNestedTo(nested);
+            value.releaseContainer();
+            value.type = ValueType::Undefined;
+        }
+    }
+
+    void moveNestedTo(std::vector<Value>& nested) noexcept {
+        auto move = [&nested](Value& child) {
+            if (child.type != ValueType::Array && child.type != ValueType::Dict)
+                return;
+
+            // Without memory for the stack, the child is left to be
+            // destroyed recursively.
+            try {
+                nested.push_back(std::move(child));
+            }
+            catch (std::bad_alloc const&) {
+            }
+        };
+
+        if (type == ValueType::Array) {
+            for (Value& child : data.array)
+                move(child);
+        }
+        else {
+            for (auto& entry : data.dict)
+                move(entry.second);
+        }
+    }
+
+    inline void releaseContainer() {
+        if (type == ValueType::Array)
+            data.array.~Array();
+        else
+            data.dict.~Dict();
+    }
 };
 
 } // namespace gcl
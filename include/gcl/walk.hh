@@ -0,0 +1,98 @@
+// Copyright 2025 Maicol Castro <maicolcastro.abc@gmail.com>.
+// Distributed under the MIT License.
+// See LICENSE.txt in the root directory of this project
+// or at https://opensource.org/license/mit.
+
+#pragma once
+
+#include <vector>
+#include "value.hh"
+
+namespace gcl {
+
+// Sends `value` to `handler` as the events a `Reader` would send for its
+// text, depth first and in the order of the containers. The containers being
+// walked are kept on a stack rather than recursed into, so that no tree is
+// too deep to walk. Undefined values are sent as `onUndefined()`, and what
+// `onKey()` returns is ignored.
+template<typename Handler>
+void walk(Value const& value, Handler& handler) {
+    struct Frame {
+        Value const* container;
+        Array::const_iterator element;
+        Dict::const_iterator entry;
+    };
+
+    std::vector<Frame> frames;
+    Value const* next = &value;
+
+    for (;;) {
+        if (next != nullptr) {
+            switch (next->type) {
+                case ValueType::Undefined:
+                    handler.onUndefined();
+                    break;
+
+                case ValueType::Null:
+                    handler.onNull();
+                    break;
+
+                case ValueType::Bool:
+                    handler.onBool(next->data.b);
+                    break;
+
+                case ValueType::Int:
+                    handler.onInt(next->data.i);
+                    break;
+
+                case ValueType::Float:
+                    handler.onFloat(next->data.f);
+                    break;
+
+                case ValueType::String:
+                    handler.onString(std::string_view(next->data.string));
+                    break;
+
+                case ValueType::Array:
+                    handler.onArrayBegin();
+                    frames.push_back({ next, next->data.array.begin(), {} });
+                    break;
+
+                case ValueType::Dict:
+                    handler.onDictBegin();
+                    frames.push_back({ next, {}, next->data.dict.begin() });
+                    break;
+            }
+        }
+
+        if (frames.empty())
+            return;
+
+        Frame& frame = frames.back();
+
+        if (frame.container->type == ValueType::Array) {
+            if (frame.element == frame.container->data.array.end()) {
+                handler.onArrayEnd();
+                frames.pop_back();
+                next = nullptr;
+                continue;
+            }
+
+            next = &*frame.element++;
+        }
+        else {
+            if (frame.entry == frame.container->data.dict.end()) {
+                handler.onDictEnd();
+                frames.pop_back();
+                next = nullptr;
+                continue;
+            }
+
+            handler.onKey(std::string_view(frame.entry->first));
+            next = &frame.entry->second;
+            ++frame.entry;
+        }
+    }
+}
+
+} // namespace gcl
@@ -0,0 +1,711 @@
+// Copyright 2025 Maicol Castro <maicolcastro.abc@gmail.com>.
+// Distributed under the MIT License.
+// See LICENSE.txt in the root directory of this project
+// or at https://opensource.org/license/mit.
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+#include <gcl/binary.hh>
+
+using namespace gcl;
+
+static constexpr char MAGIC[4] = { 'G', 'C', 'L', 'B' };
+static constexpr uint32_t VERSION = 1;
+static constexpr uint32_t DEDUP_VERSION = 2;
+static constexpr size_t HEADER_SIZE = 16;
+
+enum Tag : uint8_t {
+    TAG_UNDEFINED,
+    TAG_NULL,
+    TAG_FALSE,
+    TAG_TRUE,
+    TAG_INT,
+    TAG_FLOAT,
+    TAG_STRING,
+    TAG_ARRAY,
+    TAG_DICT,
+    TAG_DOUBLE,
+    TAG_REF,
+};
+
+// Tag, count and byte size.
+static constexpr size_t CONTAINER_HEADER_SIZE = 9;
+
+// Tag and offset.
+static constexpr size_t REF_SIZE = 5;
+
+class BinaryEncoder {
+public:
+    explicit BinaryEncoder(EncodeOptions const& options) : m_options{options} {}
+
+    std::string encode(Value const& value);
+
+private:
+    // Of a value in the order `writeValue` visits them, with `dedup`.
+    struct Node {
+        uint64_t hash;
+
+        // Of the value and the values inside it.
+        size_t count;
+    };
+
+    struct Written {
+        Value const* value;
+        uint32_t offset;
+    };
+
+    EncodeOptions m_options;
+    std::string m_output;
+    std::vector<std::string_view> m_keys;
+
+    std::vector<Node> m_nodes;
+    size_t m_nodeIndex = 0;
+
+    // The strings and containers written in full, by their hash.
+    std::unordered_multimap<uint64_t, Written> m_written;
+
+    uint64_t collect(Value const& value);
+    void writeValue(Value const& value);
+    bool writeRef(Value const& value);
+
+    inline void putU8(uint8_t x) {
+        m_output.push_back(static_cast<char>(x));
+    }
+
+    inline void putU32(uint32_t x) {
+        for (int i = 0; i < 4; ++i)
+            m_output.push_back(static_cast<char>(x >> (i * 8)));
+    }
+
+    inline void putU64(uint64_t x) {
+        for (int i = 0; i < 8; ++i)
+            m_output.push_back(static_cast<char>(x >> (i * 8)));
+    }
+
+    inline void patchU32(size_t offset, uint32_t x) {
+        for (int i = 0; i < 4; ++i)
+            m_output[offset + i] = static_cast<char>(x >> (i * 8));
+    }
+
+    inline uint32_t toU32(size_t x) const {
+        if (x > std::numeric_limits<uint32_t>::max())
+            throw std::runtime_error("gcl::encodeBinary() -> value too large");
+
+        return static_cast<uint32_t>(x);
+    }
+};
+
+static uint64_t mix(uint64_t hash, uint64_t x) {
+    // The combining step of boost::hash_combine, widened to 64 bits.
+    return hash ^ (x + 0x9e3779b97f4a7c15 + (hash << 12) + (hash >> 4));
+}
+
+// Whether the two values have the same encoding.
+static bool isEqual(Value const& a, Value const& b) {
+    if (a.type != b.type)
+        return false;
+
+    switch (a.type) {
+        case ValueType::Bool:
+            return a.data.b == b.data.b;
+
+        case ValueType::Int:
+            return a.data.i == b.data.i;
+
+        case ValueType::Float:
+            return std::bit_cast<uint64_t>(static_cast<double>(a.data.f)) == std::bit_cast<uint64_t>(static_cast<double>(b.data.f));
+
+        case ValueType::String:
+            return std::string_view(a.data.string) == std::string_view(b.data.string);
+
+        case ValueType::Array:
+            return std::equal(a.data.array.begin(), a.data.array.end(), b.data.array.begin(), b.data.array.end(), isEqual);
+
+        case ValueType::Dict:
+            return std::equal(a.data.dict.begin(), a.data.dict.end(), b.data.dict.begin(), b.data.dict.end(), [](auto const& x, auto const& y) {
+                return std::string_view(x.first) == std::string_view(y.first) && isEqual(x.second, y.second);
+            });
+
+        default:
+            return true;
+    }
+}
+
+std::string gcl::encodeBinary(Value const& value, EncodeOptions const& options) {
+    BinaryEncoder encoder(options);
+    return encoder.encode(value);
+}
+
+std::string BinaryEncoder::encode(Value const& value) {
+    collect(value);
+
+    std::sort(m_keys.begin(), m_keys.end());
+    m_keys.erase(std::unique(m_keys.begin(), m_keys.end()), m_keys.end());
+
+    m_output.append(MAGIC, sizeof(MAGIC));
+    putU32(m_options.dedup ? DEDUP_VERSION : VERSION);
+    putU32(toU32(m_keys.size()));
+    putU32(0);
+
+    size_t keyOffset = HEADER_SIZE + m_keys.size() * 8;
+
+    for (std::string_view key : m_keys) {
+        putU32(toU32(keyOffset));
+        putU32(toU32(key.length()));
+        keyOffset += key.length();
+    }
+
+    for (std::string_view key : m_keys)
+        m_output.append(key);
+
+    patchU32(12, toU32(m_output.size()));
+    writeValue(value);
+
+    // Every offset in the output must fit in a u32.
+    toU32(m_output.size());
+
+    return std::move(m_output);
+}
+
+// Collects the keys, and with `dedup` the nodes, of `value` and of the values
+// inside it. Returns the hash of `value`, or 0 without `dedup`.
+uint64_t BinaryEncoder::collect(Value const& value) {
+    size_t index = m_nodes.size();
+
+    if (m_options.dedup)
+        m_nodes.push_back({ 0, 0 });
+
+    uint64_t hash = static_cast<uint64_t>(value.type);
+
+    switch (value.type) {
+        case ValueType::Bool:
+            hash = mix(hash, value.data.b);
+            break;
+
+        case ValueType::Int:
+            hash = mix(hash, static_cast<uint64_t>(value.data.i));
+            break;
+
+        case ValueType::Float:
+            hash = mix(hash, std::bit_cast<uint64_t>(static_cast<double>(value.data.f)));
+            break;
+
+        case ValueType::String:
+            if (m_options.dedup)
+                hash = mix(hash, std::hash<std::string_view>()(std::string_view(value.data.string)));
+
+            break;
+
+        case ValueType::Array:
+            for (Value const& element : value.data.array)
+                hash = mix(hash, collect(element));
+
+            break;
+
+        case ValueType::Dict:
+            for (auto const& [key, element] : value.data.dict) {
+                m_keys.push_back(key);
+
+                if (m_options.dedup)
+                    hash = mix(hash, std::hash<std::string_view>()(std::string_view(key)));
+
+                hash = mix(hash, collect(element));
+            }
+
+            break;
+
+        default:
+            break;
+    }
+
+    if (!m_options.dedup)
+        return 0;
+
+    m_nodes[index] = { hash, m_nodes.size() - index };
+
+    return hash;
+}
+
+// With `dedup`, writes a ref if a string or container equal to `value` was
+// already written, and otherwise remembers where `value` is to be written.
+// Returns whether a ref was written.
+bool BinaryEncoder::writeRef(Value const& value) {
+    if (!m_options.dedup)
+        return false;
+
+    Node const& node = m_nodes[m_nodeIndex];
+    bool isShared;
+
+    switch (value.type) {
+        case ValueType::String:
+            isShared = !value.data.string.empty();
+            break;
+
+        case ValueType::Array:
+            isShared = !value.data.array.empty();
+            break;
+
+        case ValueType::Dict:
+            isShared = !value.data.dict.empty();
+            break;
+
+        default:
+            isShared = false;
+            break;
+    }
+
+    if (!isShared) {
+        ++m_nodeIndex;
+        return false;
+    }
+
+    auto [begin, end] = m_written.equal_range(node.hash);
+
+    for (auto it = begin; it != end; ++it) {
+        if (isEqual(*it->second.value, value)) {
+            putU8(TAG_REF);
+            putU32(it->second.offset);
+            m_nodeIndex += node.count;
+
+            return true;
+        }
+    }
+
+    m_written.emplace(node.hash, Written{ &value, toU32(m_output.size()) });
+    ++m_nodeIndex;
+
+    return false;
+}
+
+void BinaryEncoder::writeValue(Value const& value) {
+    if (writeRef(value))
+        return;
+
+    switch (value.type) {
+        case ValueType::Undefined:
+            putU8(TAG_UNDEFINED);
+            break;
+
+        case ValueType::Null:
+            putU8(TAG_NULL);
+            break;
+
+        case ValueType::Bool:
+            putU8(value.data.b ? TAG_TRUE : TAG_FALSE);
+            break;
+
+        case ValueType::Int:
+            putU8(TAG_INT);
+            putU64(static_cast<uint64_t>(static_cast<int64_t>(value.data.i)));
+            break;
+
+        case ValueType::Float: {
+            // Unless `Float` is a double, every float fits in an f32. NaNs
+            // are kept as f32 too.
+            float narrow = static_cast<float>(value.data.f);
+
+            if (static_cast<Float>(narrow) == value.data.f || value.data.f != value.data.f) {
+                putU8(TAG_FLOAT);
+                putU32(std::bit_cast<uint32_t>(narrow));
+            }
+            else {
+                putU8(TAG_DOUBLE);
+                putU64(std::bit_cast<uint64_t>(static_cast<double>(value.data.f)));
+            }
+
+            break;
+        }
+
+        case ValueType::String:
+            putU8(TAG_STRING);
+            putU32(toU32(value.data.string.length()));
+            m_output.append(value.data.string);
+            break;
+
+        case ValueType::Array: {
+            putU8(TAG_ARRAY);
+            putU32(toU32(value.data.array.size()));
+
+            size_t sizeOffset = m_output.size();
+            putU32(0);
+
+            for (Value const& element : value.data.array)
+                writeValue(element);
+
+            patchU32(sizeOffset, toU32(m_output.size() - sizeOffset - 4));
+            break;
+        }
+
+        case ValueType::Dict: {
+            putU8(TAG_DICT);
+            putU32(toU32(value.data.dict.size()));
+
+            size_t sizeOffset = m_output.size();
+            putU32(0);
+
+            for (auto const& [key, element] : value.data.dict) {
+                putU32(static_cast<uint32_t>(std::lower_bound(m_keys.begin(), m_keys.end(), std::string_view(key)) - m_keys.begin()));
+                writeValue(element);
+            }
+
+            patchU32(sizeOffset, toU32(m_output.size() - sizeOffset - 4));
+            break;
+        }
+    }
+}
+
+BinaryDocument::BinaryDocument(char const* data, size_t size)
+    : m_data{reinterpret_cast<unsigned char const*>(data)}, m_size{size}, m_keyCount{0}, m_rootOffset{0}
+{
+    if (m_size < HEADER_SIZE || std::memcmp(m_data, MAGIC, sizeof(MAGIC)) != 0)
+        throw std::runtime_error("BinaryDocument() -> not a GCL binary document");
+
+    if (uint32_t version = readU32(4); version != VERSION && version != DEDUP_VERSION)
+        throw std::runtime_error("BinaryDocument() -> unsupported version");
+
+    m_keyCount = readU32(8);
+    m_rootOffset = readU32(12);
+
+    if (m_keyCount > (m_size - HEADER_SIZE) / 8 || m_rootOffset < HEADER_SIZE + m_keyCount * 8)
+        throw std::runtime_error("BinaryDocument() -> corrupt header");
+
+    check(m_rootOffset, 1);
+}
+
+std::string_view BinaryDocument::key(size_t index) const {
+    if (index >= m_keyCount)
+        throw std::runtime_error("BinaryDocument::key() -> index out of range");
+
+    size_t entry = HEADER_SIZE + index * 8;
+    size_t offset = readU32(entry);
+    size_t length = readU32(entry + 4);
+    check(offset, length);
+
+    return std::string_view(reinterpret_cast<char const*>(m_data) + offset, length);
+}
+
+void BinaryDocument::check(size_t offset, size_t length) const {
+    if (offset > m_size || length > m_size - offset)
+        throw std::runtime_error("BinaryDocument -> truncated data");
+}
+
+uint8_t BinaryDocument::readU8(size_t offset) const {
+    check(offset, 1);
+    return m_data[offset];
+}
+
+uint32_t BinaryDocument::readU32(size_t offset) const {
+    check(offset, 4);
+
+    uint32_t x = 0;
+
+    for (int i = 0; i < 4; ++i)
+        x |= static_cast<uint32_t>(m_data[offset + i]) << (i * 8);
+
+    return x;
+}
+
+uint64_t BinaryDocument::readU64(size_t offset) const {
+    check(offset, 8);
+
+    uint64_t x = 0;
+
+    for (int i = 0; i < 8; ++i)
+        x |= static_cast<uint64_t>(m_data[offset + i]) << (i * 8);
+
+    return x;
+}
+
+// Returns the offset right after the value at `offset`.
+size_t BinaryDocument::skip(size_t offset) const {
+    switch (readU8(offset)) {
+        case TAG_UNDEFINED:
+        case TAG_NULL:
+        case TAG_FALSE:
+        case TAG_TRUE:
+            return offset + 1;
+
+        case TAG_INT:
+            return offset + 9;
+
+        case TAG_FLOAT:
+            return offset + 5;
+
+        case TAG_DOUBLE:
+            return offset + 9;
+
+        case TAG_STRING:
+            return offset + 5 + readU32(offset + 1);
+
+        case TAG_ARRAY:
+        case TAG_DICT:
+            return offset + CONTAINER_HEADER_SIZE + readU32(offset + 5);
+
+        case TAG_REF:
+            return offset + REF_SIZE;
+
+        default:
+            throw std::runtime_error("BinaryDocument -> unknown tag");
+    }
+}
+
+// Returns the offset of the value that the ref at `offset` points to, or
+// `offset` if there is no ref. Refs only point to values that are not refs
+// and end before the ref, so that no ref is inside its own target and corrupt
+// data cannot make a cycle.
+size_t BinaryDocument::resolve(size_t offset) const {
+    if (readU8(offset) != TAG_REF)
+        return offset;
+
+    size_t target = readU32(offset + 1);
+
+    if (target < m_rootOffset || target >= offset || readU8(target) == TAG_REF || skip(target) > offset)
+        throw std::runtime_error("BinaryDocument -> corrupt ref");
+
+    return target;
+}
+
+BinaryValue::BinaryValue(BinaryDocument const* document, size_t offset) : m_document{document}, m_offset{document->resolve(offset)} {}
+
+std::optional<size_t> BinaryDocument::findKey(std::string_view key) const {
+    size_t low = 0;
+    size_t high = m_keyCount;
+
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        std::string_view name = this->key(middle);
+
+        if (name == key)
+            return middle;
+
+        if (name < key)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+
+    return std::nullopt;
+}
+
+ValueType BinaryValue::type() const {
+    switch (m_document->readU8(m_offset)) {
+        case TAG_UNDEFINED: return ValueType::Undefined;
+        case TAG_NULL: return ValueType::Null;
+        case TAG_FALSE: return ValueType::Bool;
+        case TAG_TRUE: return ValueType::Bool;
+        case TAG_INT: return ValueType::Int;
+        case TAG_FLOAT: return ValueType::Float;
+        case TAG_DOUBLE: return ValueType::Float;
+        case TAG_STRING: return ValueType::String;
+        case TAG_ARRAY: return ValueType::Array;
+        case TAG_DICT: return ValueType::Dict;
+        default:
+            throw std::runtime_error("BinaryDocument -> unknown tag");
+    }
+}
+
+void BinaryValue::expectTag(uint8_t first, uint8_t last, char const* function) const {
+    uint8_t tag = m_document->readU8(m_offset);
+
+    if (tag < first || tag > last)
+        throw std::runtime_error(std::string(function) + " -> type mismatch");
+}
+
+bool BinaryValue::getBool() const {
+    expectTag(TAG_FALSE, TAG_TRUE, "BinaryValue::getBool()");
+    return m_document->readU8(m_offset) == TAG_TRUE;
+}
+
+intptr_t BinaryValue::getInt() const {
+    expectTag(TAG_INT, TAG_INT, "BinaryValue::getInt()");
+    return static_cast<intptr_t>(static_cast<int64_t>(m_document->readU64(m_offset + 1)));
+}
+
+Float BinaryValue::getFloat() const {
+    if (m_document->readU8(m_offset) == TAG_DOUBLE)
+        return static_cast<Float>(std::bit_cast<double>(m_document->readU64(m_offset + 1)));
+
+    expectTag(TAG_FLOAT, TAG_FLOAT, "BinaryValue::getFloat()");
+    return std::bit_cast<float>(m_document->readU32(m_offset + 1));
+}
+
+std::string_view BinaryValue::getString() const {
+    expectTag(TAG_STRING, TAG_STRING, "BinaryValue::getString()");
+
+    size_t length = m_document->readU32(m_offset + 1);
+    m_document->check(m_offset + 5, length);
+
+    return std::string_view(reinterpret_cast<char const*>(m_document->m_data) + m_offset + 5, length);
+}
+
+size_t BinaryValue::size() const {
+    expectTag(TAG_ARRAY, TAG_DICT, "BinaryValue::size()");
+    return m_document->readU32(m_offset + 1);
+}
+
+BinaryValue BinaryValue::at(size_t index) const {
+    expectTag(TAG_ARRAY, TAG_ARRAY, "BinaryValue::at()");
+
+    if (index >= m_document->readU32(m_offset + 1))
+        throw std::out_of_range("BinaryValue::at() -> index out of range");
+
+    size_t offset = m_offset + CONTAINER_HEADER_SIZE;
+
+    for (size_t i = 0; i < index; ++i)
+        offset = m_document->skip(offset);
+
+    return BinaryValue(m_document, offset);
+}
+
+std::optional<BinaryValue> BinaryValue::find(std::string_view key) const {
+    expectTag(TAG_DICT, TAG_DICT, "BinaryValue::find()");
+
+    // Keys are compared by their index in the sorted key table, so a key that
+    // is not in the table is not in any dict.
+    std::optional<size_t> keyIndex = m_document->findKey(key);
+
+    if (!keyIndex)
+        return std::nullopt;
+
+    size_t count = m_document->readU32(m_offset + 1);
+    size_t offset = m_offset + CONTAINER_HEADER_SIZE;
+
+    for (size_t i = 0; i < count; ++i) {
+        size_t index = m_document->readU32(offset);
+
+        if (index == *keyIndex)
+            return BinaryValue(m_document, offset + 4);
+
+        // Entries are in key order too.
+        if (index > *keyIndex)
+            break;
+
+        offset = m_document->skip(offset + 4);
+    }
+
+    return std::nullopt;
+}
+
+BinaryIterator BinaryValue::begin() const {
+    expectTag(TAG_ARRAY, TAG_DICT, "BinaryValue::begin()");
+    return BinaryIterator(m_document, m_offset + CONTAINER_HEADER_SIZE, m_document->readU8(m_offset) == TAG_DICT);
+}
+
+BinaryIterator BinaryValue::end() const {
+    expectTag(TAG_ARRAY, TAG_DICT, "BinaryValue::end()");
+    return BinaryIterator(m_document, m_document->skip(m_offset), m_document->readU8(m_offset) == TAG_DICT);
+}
+
+// Containers are filled in from a stack rather than by recursion, as in
+// `walk()`, so that no document is too deep to decode.
+void BinaryValue::decode(Value& output, std::pmr::memory_resource* resource) const {
+    struct Frame {
+        Value* container;
+        BinaryIterator next;
+        BinaryIterator end;
+    };
+
+    std::vector<Frame> frames;
+
+    if (decodeShallow(output, resource))
+        frames.push_back({ &output, begin(), end() });
+
+    while (!frames.empty()) {
+        Frame& frame = frames.back();
+
+        if (frame.next == frame.end) {
+            frames.pop_back();
+            continue;
+        }
+
+        BinaryEntry entry = *frame.next;
+        ++frame.next;
+
+        Value* value;
+
+        if (frame.container->type == ValueType::Array)
+            value = &frame.container->data.array.emplace_back();
+        else
+            value = &frame.container->data.dict.try_emplace(Key(entry.key, resource)).first->second;
+
+        if (entry.value.decodeShallow(*value, resource))
+            frames.push_back({ value, entry.value.begin(), entry.value.end() });
+    }
+}
+
+// Decodes a scalar, or an empty container for the caller to fill in. Returns
+// whether it was a container.
+bool BinaryValue::decodeShallow(Value& output, std::pmr::memory_resource* resource) const {
+    switch (m_document->readU8(m_offset)) {
+        case TAG_UNDEFINED:
+            output = Value();
+            return false;
+
+        case TAG_NULL:
+            output = Value(nullptr);
+            return false;
+
+        case TAG_FALSE:
+        case TAG_TRUE:
+            output = Value(getBool());
+            return false;
+
+        case TAG_INT:
+            output = Value(getInt());
+            return false;
+
+        case TAG_FLOAT:
+        case TAG_DOUBLE:
+            output = Value(getFloat());
+            return false;
+
+        case TAG_STRING:
+            output = Value(String(getString(), resource));
+            return false;
+
+        case TAG_ARRAY:
+            output = Value(Array(resource));
+
+            // Every element takes at least a byte, which bounds the count of
+            // a corrupt array.
+            output.data.array.reserve(std::min<size_t>(size(), m_document->m_size - m_offset));
+
+            return true;
+
+        case TAG_DICT:
+            output = Value(Dict(resource));
+            return true;
+
+        default:
+            throw std::runtime_error("BinaryDocument -> unknown tag");
+    }
+}
+
+BinaryEntry BinaryIterator::operator *() const {
+    if (m_isDict)
+        return { m_document->key(m_document->readU32(m_offset)), BinaryValue(m_document, m_offset + 4) };
+
+    return { std::string_view(), BinaryValue(m_document, m_offset) };
+}
+
+BinaryIterator& BinaryIterator::operator ++() {
+    m_offset = m_isDict ? m_document->skip(m_offset + 4) : m_document->skip(m_offset);
+    return *this;
+}
+
+void gcl::decodeBinary(Value& output, char const* data, size_t size) {
+    BinaryDocument document(data, size);
+    document.root().decode(output);
+}
+
+void gcl::decodeBinary(Document& output, char const* data, size_t size) {
+    output.clear();
+
+    BinaryDocument document(data, size);
+    document.root().decode(output.root(), output.resource());
+}
@@ -0,0 +1,102 @@
+// Copyright 2025 Maicol Castro <maicolcastro.abc@gmail.com>.
+// Distributed under the MIT License.
+// See LICENSE.txt in the root directory of this project
+// or at https://opensource.org/license/mit.
+
+#include <vector>
+#include <gcl/bind.hh>
+
+using namespace gcl;
+
+// Follows the grammar of `Reader::readItems()`, with the open containers kept
+// on a stack rather than the call stack.
+void Binder::skip() {
+    Token& token = m_tokenizer.token();
+
+    // Whether each open container is a dict, innermost last.
+    std::vector<bool> containers;
+
+    for (;;) {
+        // At the value, at the start of the innermost container, or after a
+        // comma.
+        bool isItem = containers.empty() || (containers.back() ? token.kind == TokenKind::Identifier : !isPunctuaction(Punctuaction::Rsqb));
+
+        if (isItem) {
+            if (!containers.empty() && containers.back()) {
+                m_tokenizer.advance();
+                expectPunctuaction(Punctuaction::Colon, ":");
+            }
+
+            if (isPunctuaction(Punctuaction::Lbrace) || isPunctuaction(Punctuaction::Lsqb)) {
+                if (containers.size() >= DEFAULT_MAX_DEPTH)
+                    throw GclException(GclErrorID::NestingTooDeep, m_tokenizer.spanOf(token), "containers nested too deeply");
+
+                containers.push_back(isPunctuaction(Punctuaction::Lbrace));
+                m_tokenizer.advance();
+
+                continue;
+            }
+
+            skipScalar();
+
+            if (containers.empty())
+                return;
+        }
+        else {
+            expectPunctuaction(containers.back() ? Punctuaction::Rbrace : Punctuaction::Rsqb, containers.back() ? "}" : "]");
+            containers.pop_back();
+
+            if (containers.empty())
+                return;
+        }
+
+        // After an item, which may have closed any number of containers.
+        for (;;) {
+            if (isPunctuaction(Punctuaction::Comma)) {
+                m_tokenizer.advance();
+                break;
+            }
+
+            if (!isPunctuaction(containers.back() ? Punctuaction::Rbrace : Punctuaction::Rsqb))
+                throw GclException(GclErrorID::ExpectedPunctuaction, m_tokenizer.spanOf(token), std::format("expected `,` but found `{}`", token));
+
+            m_tokenizer.advance();
+            containers.pop_back();
+
+            if (containers.empty())
+                return;
+        }
+    }
+}
+
+// Any punctuaction but a bracket is an undefined value, as for the parser, and
+// is left for the caller.
+void Binder::skipScalar() {
+    Token const& token = m_tokenizer.token();
+
+    switch (token.kind) {
+        case TokenKind::Punctuaction:
+            return;
+
+        case TokenKind::String:
+        case TokenKind::Int:
+        case TokenKind::Float:
+            break;
+
+        case TokenKind::Identifier:
+            if (token.data.identifier == "true" || token.data.identifier == "false" || token.data.identifier == "null")
+                break;
+
+            [[fallthrough]];
+
+        default:
+            throw GclException(GclErrorID::ExpectedValue, m_tokenizer.spanOf(token), std::format("expected a value but found `{}`", token));
+    }
+
+    m_tokenizer.advance();
+}
+
+void Binder::throwTypeMismatch(char const* expected) {
+    Token const& token = m_tokenizer.token();
+    throw GclException(GclErrorID::TypeMismatch, m_tokenizer.spanOf(token), std::format("expected {} but found `{}`", expected, token));
+}
@@ -0,0 +1,62 @@
+// Copyright 2025 Maicol Castro <maicolcastro.abc@gmail.com>.
+// Distributed under the MIT License.
+// See LICENSE.txt in the root directory of this project
+// or at https://opensource.org/license/mit.
+
+#include <format>
+#include <gcl/exception.hh>
+#include <gcl/tokenizer.hh>
+
+using namespace gcl;
+
+std::string GclError::message() const {
+    // Errors found by the parser are reported at the token they are about,
+    // which is lexed again to name it, unless it was a string decoded in
+    // place.
+    auto foundToken = [this]() -> std::string {
+        if (foundString.data() != nullptr)
+            return std::string(foundString);
+
+        Tokenizer tokenizer;
+        tokenizer.setText(text.data(), text.length());
+        tokenizer.seek(span.beginOffset);
+        tokenizer.tryAdvance();
+
+        return std::format("{}", tokenizer.token());
+    };
+
+    switch (errorID) {
+        case GclErrorID::ExpectedPunctuaction:
+            return std::format("expected `{}` but found `{}`", chr, foundToken());
+
+        case GclErrorID::ExpectedStringEnd:
+            return "expected string end";
+
+        case GclErrorID::ExpectedValue:
+            return std::format("expected a value but found `{}`", foundToken());
+
+        case GclErrorID::KeyAlreadyDefined:
+            return std::format("key `{}` already defined", text.substr(span.beginOffset, span.endOffset - span.beginOffset));
+
+        case GclErrorID::ExpectedNumber:
+            return std::format("expected a number after `{}`", chr);
+
+        case GclErrorID::ValueOutOfRange:
+            return "number out of range";
+
+        case GclErrorID::NestingTooDeep:
+            return "containers nested too deeply";
+
+        case GclErrorID::InvalidDigit:
+            return std::format("invalid digit `{}` for base {}", chr, base);
+
+        case GclErrorID::InvalidEscape:
+            return std::format("invalid escape sequence `{}`", chr);
+
+        case GclErrorID::UnknownChar:
+            return std::format("unknown character `{}`", chr);
+
+        default:
+            return "invalid document";
+    }
+}
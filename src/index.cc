@@ -0,0 +1,169 @@
+// Copyright 2025 Maicol Castro <maicolcastro.abc@gmail.com>.
+// Distributed under the MIT License.
+// See LICENSE.txt in the root directory of this project
+// or at https://opensource.org/license/mit.
+
+#include <bit>
+#include <cstring>
+#include <gcl/index.hh>
+#include "scan.hh"
+
+using namespace gcl;
+
+// The bits from `begin` up to, but not including, `end`.
+static inline uint64_t bitRange(int begin, int end) {
+    uint64_t below = end < 64 ? (uint64_t(1) << end) - 1 : ~uint64_t(0);
+    return below & ~((uint64_t(1) << begin) - 1);
+}
+
+// The bits of the characters escaped by a backslash. Backslashes are rare, so
+// they are taken one at a time. `isEscaped` carries a backslash at the end of
+// a block over to the next one.
+static inline uint64_t findEscaped(uint64_t backslash, bool& isEscaped) {
+    uint64_t escaped = 0;
+
+    if (isEscaped) {
+        escaped = 1;
+        backslash &= ~uint64_t(1);
+    }
+
+    isEscaped = false;
+
+    while (backslash != 0) {
+        int i = std::countr_zero(backslash);
+
+        if (i == 63) {
+            isEscaped = true;
+            break;
+        }
+
+        escaped |= uint64_t(1) << (i + 1);
+        backslash &= ~(uint64_t(3) << i);
+    }
+
+    return escaped;
+}
+
+bool StructuralIndex::build(char const* chars, size_t length) {
+    clear();
+
+    if (length >= UINT32_MAX)
+        return false;
+
+    m_chars = chars;
+    m_length = length;
+
+    // Most tokens are followed by at least a byte of something else.
+    m_tokens.reserve(length / 4);
+
+    // Carried from one block to the next: whether it starts in a string or a
+    // comment, with an escaped character, or in the middle of a token.
+    uint64_t inString = 0;
+    bool inComment = false;
+    bool isEscaped = false;
+    uint64_t wasInToken = 0;
+
+    char padded[64];
+
+    for (size_t base = 0; base < length; base += 64) {
+        char const* block = chars + base;
+
+        // The end is padded with spaces, which end any token but a string.
+        if (length - base < 64) {
+            std::memset(padded, ' ', sizeof(padded));
+            std::memcpy(padded, block, length - base);
+            block = padded;
+        }
+
+        scan::BlockMasks masks = scan::classifyBlock(block);
+        uint64_t quote = masks.quote & ~findEscaped(masks.backslash, isEscaped);
+        uint64_t comment = 0;
+
+        if (inComment) {
+            int end = masks.newline != 0 ? std::countr_zero(masks.newline) : 64;
+
+            comment = bitRange(0, end);
+            inComment = end == 64;
+        }
+
+        // Each pass finds the first comment sign outside strings and comments,
+        // which is exact since the quotes before it are all resolved, and
+        // drops the quotes inside its comment.
+        uint64_t strings;
+
+        for (;;) {
+            quote &= ~comment;
+            strings = scan::prefixXor(quote) ^ inString;
+
+            uint64_t hash = masks.hash & ~strings & ~comment;
+
+            if (hash == 0)
+                break;
+
+            int begin = std::countr_zero(hash);
+            uint64_t newline = masks.newline & ~bitRange(0, begin);
+            int end = newline != 0 ? std::countr_zero(newline) : 64;
+
+            comment |= bitRange(begin, end);
+            inComment = end == 64;
+        }
+
+        // Strings cannot span lines, and backslashes cannot appear outside
+        // them.
+        if ((strings & masks.newline) != 0 || (masks.backslash & ~strings & ~comment) != 0) {
+            clear();
+            return false;
+        }
+
+        inString = (strings >> 63) != 0 ? ~uint64_t(0) : 0;
+
+        // A closing quote is not in `strings`, but it is not a token either.
+        uint64_t other = ~(masks.whitespace | masks.structural | strings | quote | comment);
+        uint64_t tokens = (masks.structural & ~strings & ~comment) | (quote & strings) | (other & ~((other << 1) | wasInToken));
+
+        wasInToken = other >> 63;
+
+        for (; tokens != 0; tokens &= tokens - 1)
+            m_tokens.push_back(static_cast<uint32_t>(base + std::countr_zero(tokens)));
+    }
+
+    if (inString != 0) {
+        clear();
+        return false;
+    }
+
+    matchBrackets();
+
+    return true;
+}
+
+// Like `Tokenizer::findClose()`, brackets of either kind count towards the
+// same depth, and a bracket closed by the other kind has no match.
+void StructuralIndex::matchBrackets() {
+    m_closes.assign(m_tokens.size(), UINT32_MAX);
+
+    std::vector<uint32_t> open;
+
+    for (size_t i = 0; i < m_tokens.size(); ++i) {
+        switch (m_chars[m_tokens[i]]) {
+            case '{':
+            case '[':
+                open.push_back(static_cast<uint32_t>(i));
+                break;
+
+            case '}':
+            case ']': {
+                if (open.empty())
+                    break;
+
+                uint32_t token = open.back();
+                open.pop_back();
+
+                if ((m_chars[m_tokens[i]] == ']') == (m_chars[m_tokens[token]] == '['))
+                    m_closes[token] = m_tokens[i];
+
+                break;
+            }
+        }
+    }
+}
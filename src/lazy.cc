@@ -0,0 +1,355 @@
+// Copyright 2025 Maicol Castro <maicolcastro.abc@gmail.com>.
+// Distributed under the MIT License.
+// See LICENSE.txt in the root directory of this project
+// or at https://opensource.org/license/mit.
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+#include <gcl/exception.hh>
+#include <gcl/lazy.hh>
+#include <gcl/reader.hh>
+#include "value_builder.hh"
+
+using namespace gcl;
+
+struct LazyValue::Node {
+    ValueType type = ValueType::Undefined;
+
+    // Scalars only.
+    Value value;
+
+    // Empty for array elements.
+    std::string_view key;
+
+    // Offsets of the brackets of a container, and whether its children have
+    // been read. Scalars are always loaded.
+    size_t open = 0;
+    size_t close = 0;
+    bool isLoaded = true;
+
+    // Dict entries are sorted by key.
+    std::vector<Node> children;
+};
+
+struct LazyValue::State {
+    // Reads the children of one container into nodes. Containers among them
+    // are skipped by the reader, unless their brackets are not matched: those
+    // are read as usual, and so are built whole.
+    class Loader {
+    public:
+        inline void start(Node& node) {
+            m_node = &node;
+            m_containers.clear();
+            m_duplicate = std::string_view();
+        }
+
+        // The key defined twice that comes first in the text, if any.
+        inline std::string_view duplicate() const {
+            return m_duplicate;
+        }
+
+        inline void onUndefined() {
+            add(ValueType::Undefined, Value());
+        }
+
+        inline void onNull() {
+            add(ValueType::Null, Value(nullptr));
+        }
+
+        inline void onBool(bool x) {
+            add(ValueType::Bool, Value(x));
+        }
+
+        inline void onInt(intptr_t x) {
+            add(ValueType::Int, Value(x));
+        }
+
+        inline void onFloat(Float x) {
+            add(ValueType::Float, Value(x));
+        }
+
+        inline void onString(std::string_view x) {
+            add(ValueType::String, Value(String(x)));
+        }
+
+        inline void onArrayBegin() {
+            m_containers.push_back(&add(ValueType::Array, Value()));
+        }
+
+        inline void onArrayEnd() {
+            m_containers.pop_back();
+        }
+
+        inline void onDictBegin() {
+            m_containers.push_back(&add(ValueType::Dict, Value()));
+        }
+
+        inline bool onKey(std::string_view key) {
+            // Duplicates are found once the entries are sorted.
+            m_key = key;
+            return true;
+        }
+
+        inline void onDictEnd() {
+            sortEntries(*m_containers.back());
+            m_containers.pop_back();
+        }
+
+        inline void onSkipped(ValueType type, size_t open, size_t close) {
+            Node& node = add(type, Value());
+            node.open = open;
+            node.close = close;
+            node.isLoaded = false;
+        }
+
+    private:
+        Node* m_node = nullptr;
+        std::vector<Node*> m_containers;
+        std::string_view m_key;
+        std::string_view m_duplicate;
+
+        // The first value read is the node itself, either the root or the
+        // container being loaded.
+        inline Node& add(ValueType type, Value&& value) {
+            if (m_containers.empty()) {
+                m_node->type = type;
+                m_node->value = std::move(value);
+                m_node->isLoaded = true;
+
+                return *m_node;
+            }
+
+            Node& container = *m_containers.back();
+            Node& node = container.children.emplace_back();
+
+            node.type = type;
+            node.value = std::move(value);
+            node.isLoaded = true;
+
+            if (container.type == ValueType::Dict)
+                node.key = m_key;
+
+            return node;
+        }
+
+        void sortEntries(Node& dict) {
+            std::stable_sort(dict.children.begin(), dict.children.end(), [](Node const& a, Node const& b) {
+                return a.key < b.key;
+            });
+
+            // The sort is stable, so in a run of equal keys the second one is
+            // the first duplicate in the text.
+            for (size_t i = 1; i < dict.children.size(); ++i) {
+                std::string_view key = dict.children[i].key;
+
+                if (key != dict.children[i - 1].key || (i >= 2 && key == dict.children[i - 2].key))
+                    continue;
+
+                if (m_duplicate.data() == nullptr || key.data() < m_duplicate.data())
+                    m_duplicate = key;
+            }
+        }
+    };
+
+    State(char const* chars, size_t length) : chars{chars}, length{length}, root(), loader(), reader(loader) {}
+
+    char const* chars;
+    size_t length;
+    Node root;
+    Loader loader;
+    Reader<Loader> reader;
+
+    // Reads the children of `node`, or the root from the whole text.
+    void load(Node& node, bool isRoot = false) {
+        loader.start(node);
+
+        try {
+            if (isRoot)
+                reader.read(chars, length);
+            else
+                readContainer(reader, chars, length, node.open, node.close, node.type == ValueType::Dict);
+
+            // Only checked once the whole container is read, so an error
+            // after the duplicate is reported instead, unlike `gcl::parse`.
+            if (std::string_view key = loader.duplicate(); key.data() != nullptr) {
+                size_t offset = key.data() - chars;
+                Tokenizer& tokenizer = reader.tokenizer();
+
+                throw GclException(GclError{ GclErrorID::KeyAlreadyDefined, tokenizer.spanOf(offset, offset + key.length()), '\0', 0, tokenizer.text() });
+            }
+        }
+        catch (...) {
+            node.children.clear();
+            node.isLoaded = false;
+
+            throw;
+        }
+    }
+
+    void decode(Node const& node, Value& output, std::pmr::memory_resource* resource);
+
+private:
+    template<typename Handler>
+    static void readContainer(Reader<Handler>& reader, char const* chars, size_t length, size_t open, size_t close, bool isDict);
+};
+
+// Reads the children of the container between the brackets at `open` and
+// `close` with `reader`, and throws its error if that fails.
+template<typename Handler>
+void LazyValue::State::readContainer(Reader<Handler>& reader, char const* chars, size_t length, size_t open, size_t close, bool isDict) {
+    if (reader.readSlice(chars, length, open + 1, close, isDict))
+        return;
+
+    if (reader.hasError())
+        throw GclException(reader.error());
+
+    // The slice stopped before the closing bracket, at something that is not
+    // a key.
+    Tokenizer& tokenizer = reader.tokenizer();
+    throw GclException(GclError{ GclErrorID::ExpectedPunctuaction, tokenizer.spanOf(tokenizer.token()), isDict ? '}' : ']', 0, tokenizer.text() });
+}
+
+ValueType LazyValue::type() const {
+    return m_node->type;
+}
+
+bool LazyValue::getBool() const {
+    expectType(ValueType::Bool, "LazyValue::getBool()");
+    return m_node->value.data.b;
+}
+
+intptr_t LazyValue::getInt() const {
+    expectType(ValueType::Int, "LazyValue::getInt()");
+    return m_node->value.data.i;
+}
+
+Float LazyValue::getFloat() const {
+    expectType(ValueType::Float, "LazyValue::getFloat()");
+    return m_node->value.data.f;
+}
+
+std::string_view LazyValue::getString() const {
+    expectType(ValueType::String, "LazyValue::getString()");
+    return m_node->value.data.string;
+}
+
+size_t LazyValue::size() const {
+    if (m_node->type != ValueType::Dict)
+        expectType(ValueType::Array, "LazyValue::size()");
+
+    return load().children.size();
+}
+
+LazyValue LazyValue::at(size_t index) const {
+    if (m_node->type != ValueType::Dict)
+        expectType(ValueType::Array, "LazyValue::at()");
+
+    Node& node = load();
+
+    if (index >= node.children.size())
+        throw std::out_of_range("LazyValue::at() -> index out of range");
+
+    return LazyValue(m_state, &node.children[index]);
+}
+
+std::string_view LazyValue::keyAt(size_t index) const {
+    expectType(ValueType::Dict, "LazyValue::keyAt()");
+
+    Node& node = load();
+
+    if (index >= node.children.size())
+        throw std::out_of_range("LazyValue::keyAt() -> index out of range");
+
+    return node.children[index].key;
+}
+
+std::optional<LazyValue> LazyValue::find(std::string_view key) const {
+    expectType(ValueType::Dict, "LazyValue::find()");
+
+    Node& node = load();
+
+    auto it = std::lower_bound(node.children.begin(), node.children.end(), key, [](Node const& child, std::string_view key) {
+        return child.key < key;
+    });
+
+    if (it == node.children.end() || it->key != key)
+        return std::nullopt;
+
+    return LazyValue(m_state, &*it);
+}
+
+bool LazyValue::isLoaded() const {
+    return m_node->isLoaded;
+}
+
+void LazyValue::decode(Value& output, std::pmr::memory_resource* resource) const {
+    m_state->decode(*m_node, output, resource);
+}
+
+// Loaded containers are built from their nodes, the others read again.
+void LazyValue::State::decode(Node const& node, Value& output, std::pmr::memory_resource* resource) {
+    switch (node.type) {
+        case ValueType::String:
+            output = Value(String(node.value.data.string, resource));
+            break;
+
+        case ValueType::Array:
+        case ValueType::Dict: {
+            if (!node.isLoaded) {
+                ValueBuilder builder(output, resource);
+                Reader<ValueBuilder> reader(builder);
+
+                readContainer(reader, chars, length, node.open, node.close, node.type == ValueType::Dict);
+
+                break;
+            }
+
+            if (node.type == ValueType::Array) {
+                output = Value(Array(resource));
+                output.data.array.reserve(node.children.size());
+
+                for (Node const& child : node.children)
+                    decode(child, output.data.array.emplace_back(), resource);
+            }
+            else {
+                output = Value(Dict(resource));
+
+                for (Node const& child : node.children)
+                    decode(child, output.data.dict.try_emplace(Key(child.key, resource)).first->second, resource);
+            }
+
+            break;
+        }
+
+        default:
+            output = node.value;
+            break;
+    }
+}
+
+void LazyValue::expectType(ValueType type, char const* function) const {
+    if (m_node->type != type)
+        throw std::runtime_error(std::string(function) + " -> type mismatch");
+}
+
+LazyValue::Node& LazyValue::load() const {
+    if (!m_node->isLoaded)
+        m_state->load(*m_node);
+
+    return *m_node;
+}
+
+LazyDocument::LazyDocument(char const* chars, size_t length) : m_state{std::make_unique<LazyValue::State>(chars, length)} {
+    m_state->load(m_state->root, true);
+}
+
+LazyDocument::LazyDocument(LazyDocument&&) noexcept = default;
+
+LazyDocument::~LazyDocument() = default;
+
+LazyDocument& LazyDocument::operator =(LazyDocument&&) noexcept = default;
+
+LazyValue LazyDocument::root() {
+    return LazyValue(m_state.get(), &m_state->root);
+}
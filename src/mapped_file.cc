@@ -0,0 +1,124 @@
+// Copyright 2025 Maicol Castro <maicolcastro.abc@gmail.com>.
+// Distributed under the MIT License.
+// See LICENSE.txt in the root directory of this project
+// or at https://opensource.org/license/mit.
+
+#include <system_error>
+#include <gcl/mapped_file.hh>
+
+#ifdef _WIN32
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <windows.h>
+#else
+    #include <cerrno>
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+using namespace gcl;
+
+#ifdef _WIN32
+
+void MappedFile::open(std::filesystem::path const& path) {
+    close();
+
+    HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+    if (file == INVALID_HANDLE_VALUE)
+        throw std::system_error(GetLastError(), std::system_category(), "MappedFile::open() -> could not open file");
+
+    LARGE_INTEGER size;
+
+    if (!GetFileSizeEx(file, &size)) {
+        DWORD error = GetLastError();
+        CloseHandle(file);
+        throw std::system_error(error, std::system_category(), "MappedFile::open() -> could not get file size");
+    }
+
+    // Empty files cannot be mapped.
+    if (size.QuadPart == 0) {
+        CloseHandle(file);
+        return;
+    }
+
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    DWORD error = GetLastError();
+    CloseHandle(file);
+
+    if (mapping == nullptr)
+        throw std::system_error(error, std::system_category(), "MappedFile::open() -> could not map file");
+
+    void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+    if (data == nullptr) {
+        error = GetLastError();
+        CloseHandle(mapping);
+        throw std::system_error(error, std::system_category(), "MappedFile::open() -> could not map file");
+    }
+
+    m_data = static_cast<char const*>(data);
+    m_size = static_cast<size_t>(size.QuadPart);
+    m_handle = mapping;
+}
+
+void MappedFile::close() noexcept {
+    if (m_data != nullptr) {
+        UnmapViewOfFile(m_data);
+        CloseHandle(m_handle);
+    }
+
+    m_data = nullptr;
+    m_size = 0;
+    m_handle = nullptr;
+}
+
+#else
+
+void MappedFile::open(std::filesystem::path const& path) {
+    close();
+
+    int file = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+    if (file < 0)
+        throw std::system_error(errno, std::generic_category(), "MappedFile::open() -> could not open file");
+
+    struct stat status;
+
+    if (fstat(file, &status) != 0) {
+        int error = errno;
+        ::close(file);
+        throw std::system_error(error, std::generic_category(), "MappedFile::open() -> could not get file size");
+    }
+
+    // Empty files cannot be mapped.
+    if (status.st_size == 0) {
+        ::close(file);
+        return;
+    }
+
+    void* data = mmap(nullptr, status.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+    int error = errno;
+    ::close(file);
+
+    if (data == MAP_FAILED)
+        throw std::system_error(error, std::generic_category(), "MappedFile::open() -> could not map file");
+
+    // The tokenizer reads the file front to back exactly once.
+    madvise(data, status.st_size, MADV_SEQUENTIAL);
+
+    m_data = static_cast<char const*>(data);
+    m_size = static_cast<size_t>(status.st_size);
+}
+
+void MappedFile::close() noexcept {
+    if (m_data != nullptr)
+        munmap(const_cast<char*>(m_data), m_size);
+
+    m_data = nullptr;
+    m_size = 0;
+}
+
+#endif
@@ -0,0 +1,127 @@
+// Copyright 2025 Maicol Castro <maicolcastro.abc@gmail.com>.
+// Distributed under the MIT License.
+// See LICENSE.txt in the root directory of this project
+// or at https://opensource.org/license/mit.
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <optional>
+#include <thread>
+#include <vector>
+#include <gcl/parser.hh>
+#include <gcl/reader.hh>
+#include "split.hh"
+#include "value_builder.hh"
+
+using namespace gcl;
+
+// Inputs shorter than this are not worth starting threads for.
+static constexpr size_t MIN_PARALLEL_LENGTH = 256 * 1024;
+static constexpr size_t MIN_SLICE_LENGTH = 16 * 1024;
+
+bool gcl::parseParallel(Value& output, char const* chars, size_t length, size_t threadCount) {
+    if (threadCount == 0)
+        threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+    if (threadCount == 1 || length < MIN_PARALLEL_LENGTH)
+        return parse(output, chars, length);
+
+    Tokenizer tokenizer;
+    tokenizer.setText(chars, length);
+    tokenizer.advance();
+
+    Token const& token = tokenizer.token();
+
+    if (token.kind != TokenKind::Punctuaction || (token.data.punctuaction != Punctuaction::Lbrace && token.data.punctuaction != Punctuaction::Lsqb))
+        return parse(output, chars, length);
+
+    bool isDict = token.data.punctuaction == Punctuaction::Lbrace;
+
+    std::vector<Slice> slices;
+    std::optional<size_t> close = splitContainer(chars, length, token.offset, std::max(length / (threadCount * 4), MIN_SLICE_LENGTH), slices);
+
+    if (!close || chars[*close] != (isDict ? '}' : ']') || slices.size() < 2)
+        return parse(output, chars, length);
+
+    // Each slice is read as a container of its own. A failed slice is left to
+    // the sequential parse, which reports the first error of the whole text.
+    std::vector<Value> results(slices.size());
+    std::vector<char> isParsed(slices.size(), false);
+    std::atomic<size_t> nextSlice{0};
+
+    auto work = [&] {
+        for (size_t i; (i = nextSlice.fetch_add(1, std::memory_order_relaxed)) < slices.size();) {
+            try {
+                ValueBuilder builder(results[i], std::pmr::get_default_resource());
+                Reader<ValueBuilder> reader(builder);
+                isParsed[i] = reader.readSlice(chars, length, slices[i].begin, slices[i].end, isDict);
+            }
+            catch (...) {
+            }
+        }
+    };
+
+    {
+        std::vector<std::jthread> threads;
+        threads.reserve(std::min(threadCount, slices.size()) - 1);
+
+        for (size_t i = 1; i < std::min(threadCount, slices.size()); ++i)
+            threads.emplace_back(work);
+
+        work();
+    }
+
+    if (std::find(isParsed.begin(), isParsed.end(), false) != isParsed.end())
+        return parse(output, chars, length);
+
+    Value result;
+
+    if (isDict) {
+        result = Value(Dict());
+
+        Dict& dict = result.data.dict;
+
+    #if defined(GCL_COMPACT_VALUE) || defined(GCL_FLAT_DICT)
+        // Sorted once, as inserting each key in order would move the entries
+        // after it.
+        for (Value& slice : results) {
+            for (auto& [key, value] : slice.data.dict)
+                dict.appendUnsorted(Key(key), std::move(value));
+        }
+
+        // A key defined in two slices.
+        if (dict.sortEntries() != dict.end())
+            return parse(output, chars, length);
+    #else
+        for (Value& slice : results) {
+            for (auto& [key, value] : slice.data.dict) {
+                // A key defined in two slices.
+                if (!dict.try_emplace(Key(key), std::move(value)).second)
+                    return parse(output, chars, length);
+            }
+        }
+    #endif
+    }
+    else {
+        size_t count = 0;
+
+        for (Value const& slice : results)
+            count += slice.data.array.size();
+
+        result = Value(Array());
+        result.data.array.reserve(count);
+
+        for (Value& slice : results)
+            std::move(slice.data.array.begin(), slice.data.array.end(), std::back_inserter(result.data.array));
+    }
+
+    // Like `parse`, lex the token after the value, so that lexing errors in
+    // it are reported.
+    tokenizer.seek(*close + 1);
+    tokenizer.advance();
+
+    output = std::move(result);
+
+    return true;
+}
@@ -3,156 +3,331 @@
 // See LICENSE.txt in the root directory of this project
 // or at https://opensource.org/license/mit.
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <gcl/mapped_file.hh>
 #include <gcl/parser.hh>
-#include "tokenizer.hh"
+#include <gcl/reader.hh>
+#include "value_builder.hh"
 
 using namespace gcl;
 
-class Parser {
+bool gcl::parse(Value& output, char const* chars, size_t length) {
+    ValueBuilder builder(output, std::pmr::get_default_resource());
+    return gcl::read(builder, chars, length);
+}
+
+bool gcl::parse(Value& output, StructuralIndex const& index) {
+    ValueBuilder builder(output, std::pmr::get_default_resource());
+    Reader<ValueBuilder> reader(builder);
+
+    return reader.read(index);
+}
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Counts the allocations of the calling thread, and forwards them to the
+// default resource that was set when it was first used. It is never
+// destroyed, so that values allocated from it can outlive any parse.
+class CountingResource : public std::pmr::memory_resource {
 public:
-    bool parseValue(Value& output);
-    void parseArray(Array& output);
-    void parseDict(Dict& output);
+    static inline thread_local size_t allocationCount = 0;
+    static inline thread_local size_t allocatedBytes = 0;
 
-    Tokenizer tokenizer;
+    static CountingResource& instance() {
+        static CountingResource* resource = new CountingResource(std::pmr::get_default_resource());
+        return *resource;
+    }
+
+private:
+    std::pmr::memory_resource* m_upstream;
+
+    explicit CountingResource(std::pmr::memory_resource* upstream) : m_upstream{upstream} {}
+
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        ++allocationCount;
+        allocatedBytes += bytes;
+
+        return m_upstream->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* pointer, size_t bytes, size_t alignment) override {
+        m_upstream->deallocate(pointer, bytes, alignment);
+    }
+
+    bool do_is_equal(std::pmr::memory_resource const& that) const noexcept override {
+        return this == &that;
+    }
 };
 
-bool gcl::parse(Value& output, char const* chars, size_t length) {
-    Parser parser;
-    parser.tokenizer.setText(chars, length);
-    parser.tokenizer.advance();
-    return parser.parseValue(output);
-}
+// A `ValueBuilder` that also records what it is given in `ParseStats`.
+class StatsBuilder {
+public:
+    StatsBuilder(Value& output, ParseStats& stats)
+        : m_output{output}, m_builder(output, &CountingResource::instance()), m_stats{stats}, m_depth{0}
+    {}
 
-bool Parser::parseValue(Value& output) {
-    Token& token = tokenizer.token();
+    inline void onToken(Token const& token) {
+        ++m_stats.tokenCounts[static_cast<size_t>(token.kind)];
+        m_stats.bytesScanned = token.offset + token.length;
+    }
 
-    if (token.kind == TokenKind::Punctuaction) {
-        if (token.data.punctuaction == Punctuaction::Lbrace) {
-            output.type = ValueType::Dict;
-            new (&output.data.dict) Dict();
-            parseDict(output.data.dict);
-        }
-        else if (token.data.punctuaction == Punctuaction::Lsqb) {
-            output.type = ValueType::Array;
-            new (&output.data.array) Array();
-            parseArray(output.data.array);
-        }
+    inline void onUndefined() {
+        beforeValue();
+        m_builder.onUndefined();
     }
-    else if (token.kind == TokenKind::String) {
-        output.type = ValueType::String;
-        new (&output.data.string) String(std::move(token.data.string));
 
-        tokenizer.advance();
+    inline void onNull() {
+        beforeValue();
+        m_builder.onNull();
     }
-    else if (token.kind == TokenKind::Int) {
-        output.type = ValueType::Int;
-        output.data.i = token.data.i;
 
-        tokenizer.advance();
+    inline void onBool(bool x) {
+        beforeValue();
+        m_builder.onBool(x);
     }
-    else if (token.kind == TokenKind::Float) {
-        output.type = ValueType::Float;
-        output.data.f = token.data.f;
 
-        tokenizer.advance();
+    inline void onInt(intptr_t x) {
+        beforeValue();
+        m_builder.onInt(x);
+    }
+
+    inline void onFloat(Float x) {
+        beforeValue();
+        m_builder.onFloat(x);
+    }
+
+    inline void onString(std::string_view x) {
+        beforeValue();
+        m_builder.onString(x);
+    }
+
+    inline void onArrayBegin() {
+        beforeValue();
+        m_builder.onArrayBegin();
+        enter();
+    }
+
+    inline void onArrayEnd() {
+        m_builder.onArrayEnd();
+        --m_depth;
+    }
+
+    inline void onDictBegin() {
+        beforeValue();
+        m_builder.onDictBegin();
+        enter();
+    }
+
+    inline bool onKey(std::string_view key) {
+        return m_builder.onKey(key);
+    }
+
+    inline std::string_view onDictEnd() {
+        --m_depth;
+        return m_builder.onDictEnd();
+    }
+
+    inline void onError() {
+        m_builder.onError();
     }
-    else if (token.kind == TokenKind::Identifier) {
-        if (token.data.identifier == "true") {
-            output.type = ValueType::Bool;
-            output.data.b = true;
-        }
-        else if (token.data.identifier == "false") {
-            output.type = ValueType::Bool;
-            output.data.b = false;
-        }
-        else if (token.data.identifier == "null") {
-            output.type = ValueType::Null;
-            output.data.i = 0;
-        }
-        else {
-            return false;
-        }
 
-        tokenizer.advance();
+private:
+    Value& m_output;
+    ValueBuilder m_builder;
+    ParseStats& m_stats;
+    size_t m_depth;
+
+    // The previous value of the output is replaced by the first event, which
+    // is the only one at depth 0; it is destroyed here to be timed apart.
+    inline void beforeValue() {
+        if (m_depth != 0)
+            return;
+
+        auto begin = Clock::now();
+        m_output = Value();
+        m_stats.destroyTime += std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - begin);
     }
-    else {
-        return false;
+
+    inline void enter() {
+        m_stats.maxDepth = std::max(m_stats.maxDepth, ++m_depth);
     }
+};
+
+} // namespace
+
+bool gcl::parse(Value& output, char const* chars, size_t length, ParseStats& stats) {
+    stats = ParseStats();
+
+    size_t allocationCount = CountingResource::allocationCount;
+    size_t allocatedBytes = CountingResource::allocatedBytes;
+    auto begin = Clock::now();
+
+    StatsBuilder builder(output, stats);
+    Reader<StatsBuilder> reader(builder);
+    bool isValue = reader.tryRead(chars, length);
+
+    stats.totalTime = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - begin);
+    stats.allocationCount = CountingResource::allocationCount - allocationCount;
+    stats.allocatedBytes = CountingResource::allocatedBytes - allocatedBytes;
+
+    // Timing each token would cost more than lexing it, so the tokens the
+    // parse lexed are lexed again on their own and timed at once.
+    Tokenizer tokenizer;
+    tokenizer.setText(chars, length);
+    size_t tokenCount = stats.totalTokenCount();
+    begin = Clock::now();
 
-    return true;
+    for (size_t i = 0; i < tokenCount && tokenizer.tryAdvance(); ++i) {}
+
+    stats.tokenizeTime = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - begin);
+    stats.buildTime = std::max(stats.totalTime - stats.tokenizeTime - stats.destroyTime, ParseStats::Duration());
+
+    if (reader.hasError())
+        throw GclException(reader.error());
+
+    return isValue;
 }
 
-void Parser::parseArray(Array& output) {
-    Token& token = tokenizer.token();
+Expected<Value, GclError> gcl::tryParse(char const* chars, size_t length) {
+    Value output;
+    ValueBuilder builder(output, std::pmr::get_default_resource());
+    Reader<ValueBuilder> reader(builder);
 
-    // Eat the left square bracket.
-    tokenizer.advance();
+    if (!reader.tryRead(chars, length) && reader.hasError())
+        return Unexpected(reader.error());
 
-    for (;;) {
-        Value value;
+    return output;
+}
 
-        if (!parseValue(value))
-            throw GclException(GclErrorID::ExpectedValue, token.span, std::format("expected a value but found `{}`", token));
+bool gcl::parse(Document& output, char const* chars, size_t length) {
+    output.clear();
 
-        output.push_back(std::move(value));
+    ValueBuilder builder(output.root(), output.resource(), &output.keys());
+    return gcl::read(builder, chars, length);
+}
 
-        if (token.kind != TokenKind::Punctuaction || token.data.punctuaction != Punctuaction::Comma) {
-            if (token.kind == TokenKind::Punctuaction && token.data.punctuaction == Punctuaction::Rsqb)
-                break;
+bool gcl::parseInSitu(Value& output, char* chars, size_t length) {
+    ValueBuilder builder(output, std::pmr::get_default_resource());
+    builder.setBorrowsStrings(true);
 
-            throw GclException(GclErrorID::ExpectedPunctuaction, token.span, std::format("expected `,` but found `{}`", token));
-        }
+    Reader<ValueBuilder> reader(builder);
+    return reader.readInSitu(chars, length);
+}
 
-        tokenizer.advance();
-    }
+bool gcl::parseInSitu(Document& output, char* chars, size_t length) {
+    output.clear();
+
+    ValueBuilder builder(output.root(), output.resource(), &output.keys());
+    builder.setBorrowsStrings(true);
 
-    if (token.kind != TokenKind::Punctuaction || token.data.punctuaction != Punctuaction::Rsqb)
-        throw GclException(GclErrorID::ExpectedPunctuaction, token.span, std::format("expected `]` but found `{}`", token));
+    Reader<ValueBuilder> reader(builder);
+    return reader.readInSitu(chars, length);
+}
 
-    // Eat the right square bracket.
-    tokenizer.advance();
+bool gcl::parseFile(Value& output, std::filesystem::path const& path) {
+    MappedFile file(path);
+    return parse(output, file.data(), file.size());
 }
 
-void Parser::parseDict(Dict& output) {
-    Token& token = tokenizer.token();
+bool gcl::parseFile(Document& output, std::filesystem::path const& path) {
+    MappedFile file(path);
+    return parse(output, file.data(), file.size());
+}
 
-    // Eat the left brace.
-    tokenizer.advance();
+struct ParserContext::State {
+    State() : pool(), keys(&pool), root(), builder(root, &pool), reader(builder) {}
 
-    for (;;) {
-        if (token.kind != TokenKind::Identifier)
-            break;
+    std::pmr::unsynchronized_pool_resource pool;
+    KeyPool keys;
+    Value root;
+    ValueBuilder builder;
+    Reader<ValueBuilder> reader;
+};
 
-        std::string identifier = std::move(token.data.identifier);
-        tokenizer.advance();
+ParserContext::ParserContext() : m_state{std::make_unique<State>()} {}
 
-        if (token.kind != TokenKind::Punctuaction || token.data.punctuaction != Punctuaction::Colon)
-            throw GclException(GclErrorID::ExpectedPunctuaction, token.span, std::format("expected `:` but found `{}`", token));
+ParserContext::~ParserContext() = default;
 
-        tokenizer.advance();
+bool ParserContext::parse(Value& output, char const* chars, size_t length) {
+    m_state->builder.reset(output, std::pmr::get_default_resource());
+    return m_state->reader.read(chars, length);
+}
 
-        Value value;
+bool ParserContext::parse(char const* chars, size_t length) {
+    m_state->root.clear();
+    m_state->keys.clear();
+    m_state->builder.reset(m_state->root, &m_state->pool, &m_state->keys);
 
-        if (!parseValue(value))
-            throw GclException(GclErrorID::ExpectedValue, token.span, std::format("expected a value but found `{}`", token));
+    return m_state->reader.read(chars, length);
+}
 
-        if (auto it = output.insert({ std::move(identifier), std::move(value) }); !it.second)
-            throw GclException(GclErrorID::ExpectedPunctuaction, token.span, std::format("key `{}` already defined", it.first->first));
+Value& ParserContext::value() {
+    return m_state->root;
+}
 
-        if (token.kind != TokenKind::Punctuaction || token.data.punctuaction != Punctuaction::Comma) {
-            if (token.kind == TokenKind::Punctuaction && token.data.punctuaction == Punctuaction::Rbrace)
-                break;
+void ParserContext::setMaxDepth(size_t maxDepth) {
+    m_state->reader.setMaxDepth(maxDepth);
+}
 
-            throw GclException(GclErrorID::ExpectedPunctuaction, token.span, std::format("expected `,` but found `{}`", token));
+void gcl::parseBatch(std::span<std::string_view const> texts, std::span<Value> outputs, size_t threadCount) {
+    // Texts are handed out in blocks, so that threads do not contend over
+    // every one of them.
+    constexpr size_t BLOCK_SIZE = 64;
+
+    if (texts.size() != outputs.size())
+        throw std::invalid_argument("gcl::parseBatch() -> texts and outputs differ in size");
+
+    if (threadCount == 0)
+        threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+    threadCount = std::min(threadCount, (texts.size() + BLOCK_SIZE - 1) / BLOCK_SIZE);
+
+    std::atomic<size_t> nextBlock{0};
+    std::vector<std::exception_ptr> errors(std::max(threadCount, size_t(1)));
+    std::vector<size_t> errorIndices(errors.size(), texts.size());
+
+    auto work = [&](size_t thread) {
+        ParserContext context;
+
+        for (size_t block; (block = nextBlock.fetch_add(BLOCK_SIZE, std::memory_order_relaxed)) < texts.size();) {
+            for (size_t i = block; i < std::min(block + BLOCK_SIZE, texts.size()); ++i) {
+                outputs[i].clear();
+
+                try {
+                    context.parse(outputs[i], texts[i]);
+                }
+                catch (...) {
+                    // Blocks are taken in order, so the first error of a
+                    // thread is the one with its lowest index.
+                    if (!errors[thread]) {
+                        errors[thread] = std::current_exception();
+                        errorIndices[thread] = i;
+                    }
+                }
+            }
         }
+    };
+
+    {
+        std::vector<std::jthread> threads;
+        threads.reserve(errors.size() - 1);
+
+        for (size_t i = 1; i < errors.size(); ++i)
+            threads.emplace_back(work, i);
 
-        tokenizer.advance();
+        work(0);
     }
 
-    if (token.kind != TokenKind::Punctuaction || token.data.punctuaction != Punctuaction::Rbrace)
-        throw GclException(GclErrorID::ExpectedPunctuaction, token.span, std::format("expected `}}` but found `{}`", token));
+    size_t first = std::min_element(errorIndices.begin(), errorIndices.end()) - errorIndices.begin();
 
-    // Eat the right brace.
-    tokenizer.advance();
+    if (errors[first])
+        std::rethrow_exception(errors[first]);
 }
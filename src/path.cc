@@ -0,0 +1,80 @@
+// Copyright 2025 Maicol Castro <maicolcastro.abc@gmail.com>.
+// Distributed under the MIT License.
+// See LICENSE.txt in the root directory of this project
+// or at https://opensource.org/license/mit.
+
+#include <charconv>
+#include <format>
+#include <stdexcept>
+#include <gcl/path.hh>
+
+using namespace gcl;
+
+Path::Path(std::string_view text) {
+    size_t i = 0;
+
+    // A key may start the path or follow a dot; an index may follow anything.
+    while (i < text.length()) {
+        if (text[i] == '[') {
+            size_t close = text.find(']', i + 1);
+
+            if (close == std::string_view::npos)
+                throw std::runtime_error(std::format("Path::Path() -> unclosed `[` at {} in `{}`", i, text));
+
+            size_t index;
+            auto [end, error] = std::from_chars(text.data() + i + 1, text.data() + close, index);
+
+            if (close == i + 1 || error != std::errc() || end != text.data() + close)
+                throw std::runtime_error(std::format("Path::Path() -> invalid index at {} in `{}`", i + 1, text));
+
+            m_segments.push_back({ std::string(), index });
+            i = close + 1;
+
+            continue;
+        }
+
+        if (!m_segments.empty()) {
+            if (text[i] != '.')
+                throw std::runtime_error(std::format("Path::Path() -> expected `.` or `[` at {} in `{}`", i, text));
+
+            ++i;
+        }
+
+        size_t end = text.find_first_of(".[]", i);
+
+        if (end == std::string_view::npos)
+            end = text.length();
+
+        if (end == i)
+            throw std::runtime_error(std::format("Path::Path() -> expected a key at {} in `{}`", i, text));
+
+        m_segments.push_back({ std::string(text.substr(i, end - i)), 0 });
+        i = end;
+    }
+}
+
+Value* Path::find(Value& root) const noexcept {
+    Value* value = &root;
+
+    for (Segment const& segment : m_segments) {
+        if (segment.key.empty()) {
+            if (value->type != ValueType::Array || segment.index >= value->data.array.size())
+                return nullptr;
+
+            value = &value->data.array[segment.index];
+        }
+        else {
+            if (value->type != ValueType::Dict)
+                return nullptr;
+
+            auto it = value->data.dict.find(std::string_view(segment.key));
+
+            if (it == value->data.dict.end())
+                return nullptr;
+
+            value = &it->second;
+        }
+    }
+
+    return value;
+}
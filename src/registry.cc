@@ -0,0 +1,38 @@
+// Copyright 2025 Maicol Castro <maicolcastro.abc@gmail.com>.
+// Distributed under the MIT License.
+// See LICENSE.txt in the root directory of this project
+// or at https://opensource.org/license/mit.
+
+#include <gcl/document.hh>
+#include <gcl/mapped_file.hh>
+#include <gcl/parser.hh>
+#include <gcl/registry.hh>
+
+using namespace gcl;
+
+uint64_t ConfigRegistry::store(SharedValue value) {
+    if (!value)
+        value = SharedValue(Value());
+
+    std::lock_guard lock(m_storeMutex);
+
+    uint64_t version = m_version.load(std::memory_order_relaxed) + 1;
+
+    m_snapshot.store(std::make_shared<Snapshot const>(std::move(value), version), std::memory_order_release);
+    m_version.store(version, std::memory_order_release);
+
+    return version;
+}
+
+uint64_t ConfigRegistry::reload(char const* chars, size_t length) {
+    // Parsed before taking the lock, so that only the swap is serialized.
+    Document document;
+    parse(document, chars, length);
+
+    return store(SharedValue(std::move(document)));
+}
+
+uint64_t ConfigRegistry::reloadFile(std::filesystem::path const& path) {
+    MappedFile file(path);
+    return reload(file.data(), file.size());
+}
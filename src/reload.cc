@@ -0,0 +1,277 @@
+// Copyright 2025 Maicol Castro <maicolcastro.abc@gmail.com>.
+// Distributed under the MIT License.
+// See LICENSE.txt in the root directory of this project
+// or at https://opensource.org/license/mit.
+
+#include <algorithm>
+#include <optional>
+#include <unordered_set>
+#include <gcl/parser.hh>
+#include <gcl/reader.hh>
+#include <gcl/reload.hh>
+#include "split.hh"
+#include "value_builder.hh"
+
+using namespace gcl;
+
+static std::string childPath(std::string const& path, std::string_view key) {
+    std::string child;
+    child.reserve(path.length() + key.length() + 1);
+
+    if (!path.empty()) {
+        child += path;
+        child += '.';
+    }
+
+    child += key;
+
+    return child;
+}
+
+static std::string childPath(std::string const& path, size_t index) {
+    return path + '[' + std::to_string(index) + ']';
+}
+
+static bool isSameScalar(Value const& a, Value const& b) {
+    switch (a.type) {
+        case ValueType::Bool:
+            return a.data.b == b.data.b;
+
+        case ValueType::Int:
+            return a.data.i == b.data.i;
+
+        case ValueType::Float:
+            return a.data.f == b.data.f || (a.data.f != a.data.f && b.data.f != b.data.f);
+
+        case ValueType::String:
+            return std::string_view(a.data.string) == std::string_view(b.data.string);
+
+        default:
+            return true;
+    }
+}
+
+static void diffAt(Value const& before, Value const& after, std::string const& path, std::vector<Change>& changes) {
+    if (before.type == ValueType::Undefined) {
+        if (after.type != ValueType::Undefined)
+            changes.push_back({ ChangeKind::Added, path });
+
+        return;
+    }
+
+    if (after.type == ValueType::Undefined) {
+        changes.push_back({ ChangeKind::Removed, path });
+        return;
+    }
+
+    if (before.type != after.type) {
+        changes.push_back({ ChangeKind::Changed, path });
+        return;
+    }
+
+    if (before.type == ValueType::Array) {
+        Array const& a = before.data.array;
+        Array const& b = after.data.array;
+        size_t common = std::min(a.size(), b.size());
+
+        for (size_t i = 0; i < common; ++i)
+            diffAt(a[i], b[i], childPath(path, i), changes);
+
+        for (size_t i = common; i < b.size(); ++i)
+            changes.push_back({ ChangeKind::Added, childPath(path, i) });
+
+        for (size_t i = common; i < a.size(); ++i)
+            changes.push_back({ ChangeKind::Removed, childPath(path, i) });
+
+        return;
+    }
+
+    if (before.type == ValueType::Dict) {
+        Dict const& a = before.data.dict;
+        Dict const& b = after.data.dict;
+
+        for (auto const& [key, value] : b) {
+            auto it = a.find(key.view());
+
+            if (it == a.end())
+                changes.push_back({ ChangeKind::Added, childPath(path, key.view()) });
+            else
+                diffAt(it->second, value, childPath(path, key.view()), changes);
+        }
+
+        for (auto const& [key, value] : a) {
+            if (b.find(key.view()) == b.end())
+                changes.push_back({ ChangeKind::Removed, childPath(path, key.view()) });
+        }
+
+        return;
+    }
+
+    if (!isSameScalar(before, after))
+        changes.push_back({ ChangeKind::Changed, path });
+}
+
+void gcl::diff(Value const& before, Value const& after, std::vector<Change>& changes) {
+    diffAt(before, after, std::string(), changes);
+}
+
+namespace {
+
+// An entry of the new text, either kept from the previous value or parsed.
+struct Entry {
+    // Whether the previous value had an entry with the same text.
+    bool isKept;
+
+    // A dict of the parsed entry, empty for the empty slice after a trailing
+    // comma.
+    Value parsed;
+
+    std::string_view text;
+};
+
+} // namespace
+
+bool Reloader::reload(char const* chars, size_t length, std::vector<Change>& changes) {
+    Tokenizer tokenizer;
+    tokenizer.setText(chars, length);
+
+    if (!tokenizer.advance())
+        return reloadWhole(chars, length, changes);
+
+    Token const& token = tokenizer.token();
+
+    if (token.kind != TokenKind::Punctuaction || token.data.punctuaction != Punctuaction::Lbrace)
+        return reloadWhole(chars, length, changes);
+
+    std::vector<Slice> slices;
+    std::optional<size_t> close = splitContainer(chars, length, token.offset, 0, slices);
+
+    if (!close || chars[*close] != '}')
+        return reloadWhole(chars, length, changes);
+
+    // Nothing is modified until every entry has been parsed and checked, so
+    // that on an error the whole text is parsed instead, throwing its first
+    // error with the previous value intact. If the previous value was not
+    // read as a dict, the new one is compared to it whole.
+    bool hasEntries = !m_entries.empty();
+    uint64_t generation = ++m_generation;
+
+    std::vector<Entry> entries;
+    entries.reserve(slices.size());
+
+    // The keys of the parsed entries.
+    std::unordered_set<std::string_view> parsedKeys;
+
+    Value slice;
+    ValueBuilder builder(slice, std::pmr::get_default_resource());
+    Reader<ValueBuilder> reader(builder);
+
+    for (Slice const& each : slices) {
+        std::string_view text(chars + each.begin, each.end - each.begin);
+
+        if (auto it = m_entries.find(text); it != m_entries.end()) {
+            // Two entries with the same text define the same key twice.
+            if (it->second.generation == generation)
+                return reloadWhole(chars, length, changes);
+
+            it->second.generation = generation;
+            entries.push_back({ true, Value(), text });
+
+            continue;
+        }
+
+        builder.reset(slice, std::pmr::get_default_resource());
+
+        if (!reader.readSlice(chars, length, each.begin, each.end, true))
+            return reloadWhole(chars, length, changes);
+
+        // Cut at every comma, a slice has one entry at most.
+        if (!slice.data.dict.empty() && !parsedKeys.insert(slice.data.dict.begin()->first.view()).second)
+            return reloadWhole(chars, length, changes);
+
+        entries.push_back({ false, std::move(slice), text });
+    }
+
+    // Like `parse`, lex the token after the value, so that lexing errors in
+    // it are reported.
+    tokenizer.seek(*close + 1);
+    tokenizer.advance();
+
+    // The keys of the previous entries whose text is gone, which the parsed
+    // entries may define again.
+    std::unordered_set<std::string_view> vacatedKeys;
+
+    for (auto const& [text, info] : m_entries) {
+        if (info.generation != generation)
+            vacatedKeys.insert(info.key);
+    }
+
+    if (hasEntries) {
+        for (std::string_view key : parsedKeys) {
+            // Also defined by an entry that was kept.
+            if (m_root.data.dict.find(key) != m_root.data.dict.end() && !vacatedKeys.contains(key))
+                return reloadWhole(chars, length, changes);
+        }
+    }
+
+    Value previous;
+
+    if (!hasEntries) {
+        previous = std::move(m_root);
+        m_root = Value(Dict());
+    }
+
+    Dict& dict = m_root.data.dict;
+
+    for (Entry& entry : entries) {
+        if (entry.isKept || entry.parsed.data.dict.empty())
+            continue;
+
+        auto& [key, value] = *entry.parsed.data.dict.begin();
+        auto it = dict.find(key.view());
+
+        if (it == dict.end()) {
+            if (hasEntries)
+                changes.push_back({ ChangeKind::Added, std::string(key.view()) });
+
+            dict.try_emplace(Key(key.view()), std::move(value));
+        }
+        else {
+            diffAt(it->second, value, std::string(key.view()), changes);
+            it->second = std::move(value);
+        }
+    }
+
+    for (std::string_view key : vacatedKeys) {
+        if (!parsedKeys.contains(key)) {
+            changes.push_back({ ChangeKind::Removed, std::string(key) });
+            dict.erase(dict.find(key));
+        }
+    }
+
+    if (!hasEntries)
+        diffAt(previous, m_root, std::string(), changes);
+
+    // The keys in `vacatedKeys` point into the entries they are erased with.
+    vacatedKeys.clear();
+    std::erase_if(m_entries, [generation](auto const& entry) { return entry.second.generation != generation; });
+
+    for (Entry const& entry : entries) {
+        if (!entry.isKept && !entry.parsed.data.dict.empty())
+            m_entries.emplace(std::string(entry.text), EntryInfo{ std::string(entry.parsed.data.dict.begin()->first.view()), generation });
+    }
+
+    return true;
+}
+
+bool Reloader::reloadWhole(char const* chars, size_t length, std::vector<Change>& changes) {
+    Value value;
+    bool isValue = parse(value, chars, length);
+
+    diffAt(m_root, value, std::string(), changes);
+
+    m_root = std::move(value);
+    m_entries.clear();
+
+    return isValue;
+}
@@ -0,0 +1,307 @@
+// Copyright 2025 Maicol Castro <maicolcastro.abc@gmail.com>.
+// Distributed under the MIT License.
+// See LICENSE.txt in the root directory of this project
+// or at https://opensource.org/license/mit.
+
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// The widest instruction set enabled at compile time is used, so building
+// with `-mavx2` (or `-march=native`) selects the 32 byte path. Define
+// GCL_NO_SIMD to force the scalar fallback.
+#if !defined(GCL_NO_SIMD) && defined(__AVX2__)
+    #include <immintrin.h>
+    #define GCL_SCAN_AVX2
+#elif !defined(GCL_NO_SIMD) && defined(__SSE2__)
+    #include <emmintrin.h>
+    #define GCL_SCAN_SSE2
+#elif !defined(GCL_NO_SIMD) && defined(__ARM_NEON)
+    #include <arm_neon.h>
+    #define GCL_SCAN_NEON
+#endif
+
+#if !defined(GCL_NO_SIMD) && defined(__PCLMUL__)
+    #include <wmmintrin.h>
+#endif
+
+namespace gcl::scan {
+
+#if defined(GCL_SCAN_AVX2)
+    using Vector = __m256i;
+
+    constexpr size_t VECTOR_SIZE = 32;
+    constexpr int MASK_STRIDE = 1;
+    constexpr uint64_t FULL_MASK = 0xFFFFFFFF;
+
+    inline Vector load(char const* chars) {
+        return _mm256_loadu_si256(reinterpret_cast<__m256i const*>(chars));
+    }
+
+    inline Vector equal(Vector vector, char chr) {
+        return _mm256_cmpeq_epi8(vector, _mm256_set1_epi8(chr));
+    }
+
+    inline Vector either(Vector a, Vector b) {
+        return _mm256_or_si256(a, b);
+    }
+
+    inline uint64_t toMask(Vector vector) {
+        return static_cast<uint32_t>(_mm256_movemask_epi8(vector));
+    }
+#elif defined(GCL_SCAN_SSE2)
+    using Vector = __m128i;
+
+    constexpr size_t VECTOR_SIZE = 16;
+    constexpr int MASK_STRIDE = 1;
+    constexpr uint64_t FULL_MASK = 0xFFFF;
+
+    inline Vector load(char const* chars) {
+        return _mm_loadu_si128(reinterpret_cast<__m128i const*>(chars));
+    }
+
+    inline Vector equal(Vector vector, char chr) {
+        return _mm_cmpeq_epi8(vector, _mm_set1_epi8(chr));
+    }
+
+    inline Vector either(Vector a, Vector b) {
+        return _mm_or_si128(a, b);
+    }
+
+    inline uint64_t toMask(Vector vector) {
+        return static_cast<uint32_t>(_mm_movemask_epi8(vector));
+    }
+#elif defined(GCL_SCAN_NEON)
+    using Vector = uint8x16_t;
+
+    // NEON has no movemask, so each byte is narrowed to a nibble instead.
+    constexpr size_t VECTOR_SIZE = 16;
+    constexpr int MASK_STRIDE = 4;
+    constexpr uint64_t FULL_MASK = ~uint64_t(0);
+
+    inline Vector load(char const* chars) {
+        return vld1q_u8(reinterpret_cast<uint8_t const*>(chars));
+    }
+
+    inline Vector equal(Vector vector, char chr) {
+        return vceqq_u8(vector, vdupq_n_u8(static_cast<uint8_t>(chr)));
+    }
+
+    inline Vector either(Vector a, Vector b) {
+        return vorrq_u8(a, b);
+    }
+
+    inline uint64_t toMask(Vector vector) {
+        return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(vector), 4)), 0);
+    }
+#endif
+
+// Returns the index of the first byte at or after `index` that is not a
+// space, tab or newline, or `length` if there is none.
+inline size_t skipWhitespace(char const* chars, size_t index, size_t length) {
+#if defined(GCL_SCAN_AVX2) || defined(GCL_SCAN_SSE2) || defined(GCL_SCAN_NEON)
+    for (; index + VECTOR_SIZE <= length; index += VECTOR_SIZE) {
+        Vector vector = load(chars + index);
+        uint64_t mask = ~toMask(either(either(equal(vector, ' '), equal(vector, '\t')), equal(vector, '\n'))) & FULL_MASK;
+
+        if (mask != 0)
+            return index + std::countr_zero(mask) / MASK_STRIDE;
+    }
+#endif
+
+    for (; index < length; ++index) {
+        if (chars[index] != ' ' && chars[index] != '\t' && chars[index] != '\n')
+            break;
+    }
+
+    return index;
+}
+
+// Returns the index of the first newline at or after `index`, or `length`.
+inline size_t findNewline(char const* chars, size_t index, size_t length) {
+#if defined(GCL_SCAN_AVX2) || defined(GCL_SCAN_SSE2) || defined(GCL_SCAN_NEON)
+    for (; index + VECTOR_SIZE <= length; index += VECTOR_SIZE) {
+        if (uint64_t mask = toMask(equal(load(chars + index), '\n')); mask != 0)
+            return index + std::countr_zero(mask) / MASK_STRIDE;
+    }
+#endif
+
+    for (; index < length; ++index) {
+        if (chars[index] == '\n')
+            break;
+    }
+
+    return index;
+}
+
+// Returns the index of the first byte at or after `index` that ends a plain
+// run of string content, that is a quote, a backslash or a newline, or
+// `length` if there is none.
+inline size_t findStringSpecial(char const* chars, size_t index, size_t length) {
+#if defined(GCL_SCAN_AVX2) || defined(GCL_SCAN_SSE2) || defined(GCL_SCAN_NEON)
+    for (; index + VECTOR_SIZE <= length; index += VECTOR_SIZE) {
+        Vector vector = load(chars + index);
+        uint64_t mask = toMask(either(either(equal(vector, '"'), equal(vector, '\\')), equal(vector, '\n')));
+
+        if (mask != 0)
+            return index + std::countr_zero(mask) / MASK_STRIDE;
+    }
+#endif
+
+    for (; index < length; ++index) {
+        if (chars[index] == '"' || chars[index] == '\\' || chars[index] == '\n')
+            break;
+    }
+
+    return index;
+}
+
+// Bit `i` of each mask is set if byte `i` of a 64 byte block is in the class.
+struct BlockMasks {
+    uint64_t quote;
+    uint64_t backslash;
+    uint64_t hash;
+    uint64_t newline;
+
+    // Spaces, tabs and newlines.
+    uint64_t whitespace;
+
+    // `{`, `}`, `[`, `]`, `,` and `:`.
+    uint64_t structural;
+};
+
+#if defined(GCL_SCAN_NEON)
+    // Keeps one bit of each nibble of a NEON mask, packing them together.
+    inline uint64_t packNibbles(uint64_t mask) {
+        mask &= 0x1111111111111111;
+        mask = (mask | (mask >> 3)) & 0x0303030303030303;
+        mask = (mask | (mask >> 6)) & 0x000F000F000F000F;
+        mask = (mask | (mask >> 12)) & 0x000000FF000000FF;
+        return (mask | (mask >> 24)) & 0xFFFF;
+    }
+#endif
+
+// Classifies the 64 bytes at `chars`, which must all be readable.
+inline BlockMasks classifyBlock(char const* chars) {
+    BlockMasks masks = {};
+
+#if defined(GCL_SCAN_AVX2) || defined(GCL_SCAN_SSE2) || defined(GCL_SCAN_NEON)
+    for (size_t i = 0; i < 64; i += VECTOR_SIZE) {
+        Vector vector = load(chars + i);
+        Vector newline = equal(vector, '\n');
+
+    #if defined(GCL_SCAN_NEON)
+        auto mask = [](Vector vector) { return packNibbles(toMask(vector)); };
+    #else
+        auto mask = [](Vector vector) { return toMask(vector); };
+    #endif
+
+        masks.quote |= mask(equal(vector, '"')) << i;
+        masks.backslash |= mask(equal(vector, '\\')) << i;
+        masks.hash |= mask(equal(vector, '#')) << i;
+        masks.newline |= mask(newline) << i;
+        masks.whitespace |= mask(either(either(equal(vector, ' '), equal(vector, '\t')), newline)) << i;
+        masks.structural |= mask(either(
+            either(either(equal(vector, '{'), equal(vector, '}')), either(equal(vector, '['), equal(vector, ']'))),
+            either(equal(vector, ','), equal(vector, ':'))
+        )) << i;
+    }
+#else
+    for (size_t i = 0; i < 64; ++i) {
+        uint64_t bit = uint64_t(1) << i;
+
+        switch (chars[i]) {
+            case '"': masks.quote |= bit; break;
+            case '\\': masks.backslash |= bit; break;
+            case '#': masks.hash |= bit; break;
+            case '\n': masks.newline |= bit; masks.whitespace |= bit; break;
+            case ' ': case '\t': masks.whitespace |= bit; break;
+            case '{': case '}': case '[': case ']': case ',': case ':': masks.structural |= bit; break;
+        }
+    }
+#endif
+
+    return masks;
+}
+
+// Bit `i` of the result is the parity of bits `0` to `i` of `mask`, so that
+// the bits between each pair of quotes are set. That is a carry-less multiply
+// by all ones where PCLMUL is enabled.
+inline uint64_t prefixXor(uint64_t mask) {
+#if !defined(GCL_NO_SIMD) && defined(__PCLMUL__)
+    __m128i product = _mm_clmulepi64_si128(_mm_set_epi64x(0, static_cast<int64_t>(mask)), _mm_set1_epi8(-1), 0);
+    return static_cast<uint64_t>(_mm_cvtsi128_si64(product));
+#else
+    mask ^= mask << 1;
+    mask ^= mask << 2;
+    mask ^= mask << 4;
+    mask ^= mask << 8;
+    mask ^= mask << 16;
+    mask ^= mask << 32;
+
+    return mask;
+#endif
+}
+
+// Number lexing works on 8 digits at a time in a 64-bit integer, with the
+// first character in its lowest byte.
+inline uint64_t loadEight(char const* chars) {
+    uint64_t chunk;
+    std::memcpy(&chunk, chars, sizeof(chunk));
+
+    if constexpr (std::endian::native == std::endian::big) {
+        uint64_t swapped = 0;
+
+        for (int i = 0; i < 8; ++i)
+            swapped |= ((chunk >> (i * 8)) & 0xFF) << ((7 - i) * 8);
+
+        chunk = swapped;
+    }
+
+    return chunk;
+}
+
+// Whether all 8 characters of `chunk` are decimal digits: their high nibble
+// is 3, and adding 6 to them does not carry into it.
+inline bool isEightDigits(uint64_t chunk) {
+    return ((chunk & 0xF0F0F0F0F0F0F0F0) | (((chunk + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) == 0x3333333333333333;
+}
+
+// The value of 8 decimal digits, combining them pairwise in 3 multiplies.
+inline uint32_t parseEightDigits(uint64_t chunk) {
+    chunk = ((chunk & 0x0F0F0F0F0F0F0F0F) * 2561) >> 8;
+    chunk = ((chunk & 0x00FF00FF00FF00FF) * 6553601) >> 16;
+    return static_cast<uint32_t>(((chunk & 0x0000FFFF0000FFFF) * 42949672960001) >> 32);
+}
+
+// Returns the index of the first byte at or after `index` that is not a
+// decimal digit, or `length` if there is none.
+inline size_t skipDigits(char const* chars, size_t index, size_t length) {
+    for (; index + 8 <= length && isEightDigits(loadEight(chars + index)); index += 8)
+        ;
+
+    for (; index < length; ++index) {
+        if (chars[index] < '0' || chars[index] > '9')
+            break;
+    }
+
+    return index;
+}
+
+// The value of `count` decimal digits. Up to 19 always fit.
+inline uint64_t parseDigits(char const* chars, size_t count) {
+    uint64_t value = 0;
+
+    for (; count >= 8; chars += 8, count -= 8)
+        value = value * 100000000 + parseEightDigits(loadEight(chars));
+
+    for (; count > 0; ++chars, --count)
+        value = value * 10 + (*chars - '0');
+
+    return value;
+}
+
+} // namespace gcl::scan
@@ -0,0 +1,387 @@
+// Copyright 2025 Maicol Castro <maicolcastro.abc@gmail.com>.
+// Distributed under the MIT License.
+// See LICENSE.txt in the root directory of this project
+// or at https://opensource.org/license/mit.
+
+#include <algorithm>
+#include <format>
+#include <limits>
+#include <stdexcept>
+#include <gcl/parser.hh>
+#include <gcl/reader.hh>
+#include <gcl/schema.hh>
+#include <gcl/walk.hh>
+
+using namespace gcl;
+
+static constexpr uint32_t typeBit(ValueType type) {
+    return uint32_t(1) << static_cast<uint32_t>(type);
+}
+
+static constexpr uint32_t ANY_TYPE = (typeBit(ValueType::Dict) << 1) - 1;
+
+static uint32_t parseType(std::string_view name) {
+    if (name == "undefined") return typeBit(ValueType::Undefined);
+    if (name == "null") return typeBit(ValueType::Null);
+    if (name == "bool") return typeBit(ValueType::Bool);
+    if (name == "int") return typeBit(ValueType::Int);
+    if (name == "float") return typeBit(ValueType::Float);
+    if (name == "number") return typeBit(ValueType::Int) | typeBit(ValueType::Float);
+    if (name == "string") return typeBit(ValueType::String);
+    if (name == "array") return typeBit(ValueType::Array);
+    if (name == "dict") return typeBit(ValueType::Dict);
+    if (name == "any") return ANY_TYPE;
+
+    return 0;
+}
+
+static std::string childPath(std::string const& path, std::string_view key) {
+    return path.empty() ? std::string(key) : path + '.' + std::string(key);
+}
+
+static std::string childPath(std::string const& path, size_t index) {
+    return path + '[' + std::to_string(index) + ']';
+}
+
+Schema::Schema() : m_nodes(), m_keys() {
+    Node any = { ANY_TYPE, {}, {}, 0, 0, 0, 0, 0 };
+
+    m_nodes.push_back(any);
+    m_nodes.push_back(any);
+}
+
+Schema::Schema(Value const& schema) : Schema() {
+    m_nodes.pop_back();
+    compile(schema, std::string());
+}
+
+Schema::Schema(std::string_view text) : Schema() {
+    Value schema;
+    parse(schema, text);
+
+    m_nodes.pop_back();
+    compile(schema, std::string());
+}
+
+uint32_t Schema::compile(Value const& schema, std::string const& path) {
+    uint32_t index = static_cast<uint32_t>(m_nodes.size());
+    m_nodes.push_back({ ANY_TYPE, {}, {}, 0, 0, 0, 0, 0 });
+
+    if (schema.type == ValueType::String) {
+        std::string_view name(schema.data.string);
+
+        if ((m_nodes[index].types = parseType(name)) == 0)
+            throw std::runtime_error(std::format("Schema::Schema() -> unknown type `{}` at `{}`", name, path));
+
+        return index;
+    }
+
+    if (schema.type != ValueType::Dict)
+        throw std::runtime_error(std::format("Schema::Schema() -> expected a dict or a type name at `{}`", path));
+
+    Dict const& fields = schema.data.dict;
+
+    // Read into a local node, as compiling nested schemas moves the table.
+    Node node = m_nodes[index];
+    bool hasKeys = false;
+
+    for (auto const& [key, value] : fields) {
+        std::string_view name(key);
+
+        if (name == "type") {
+            node.types = 0;
+
+            if (value.type == ValueType::String) {
+                node.types = parseType(std::string_view(value.data.string));
+            }
+            else if (value.type == ValueType::Array) {
+                for (Value const& each : value.data.array) {
+                    uint32_t type = each.type == ValueType::String ? parseType(std::string_view(each.data.string)) : 0;
+
+                    if (type == 0) {
+                        node.types = 0;
+                        break;
+                    }
+
+                    node.types |= type;
+                }
+            }
+
+            if (node.types == 0)
+                throw std::runtime_error(std::format("Schema::Schema() -> invalid `type` at `{}`", path));
+        }
+        else if (name == "min" || name == "max") {
+            Bound& bound = name == "min" ? node.min : node.max;
+
+            if (value.type == ValueType::Int)
+                bound = { true, true, value.data.i, static_cast<double>(value.data.i) };
+            else if (value.type == ValueType::Float)
+                bound = { true, false, 0, static_cast<double>(value.data.f) };
+            else
+                throw std::runtime_error(std::format("Schema::Schema() -> expected a number for `{}` at `{}`", name, path));
+        }
+        else if (name == "elements") {
+            node.elements = compile(value, childPath(path, "elements"));
+        }
+        else if (name == "others") {
+            node.others = compile(value, childPath(path, "others"));
+        }
+        else if (name == "keys") {
+            if (value.type != ValueType::Dict)
+                throw std::runtime_error(std::format("Schema::Schema() -> expected a dict for `keys` at `{}`", path));
+
+            hasKeys = true;
+
+            // Compiled first, since the keys of a node must be contiguous.
+            std::vector<KeyNode> keys;
+            keys.reserve(value.data.dict.size());
+
+            for (auto const& [entryKey, entry] : value.data.dict) {
+                bool isRequired = true;
+
+                if (entry.type == ValueType::Dict) {
+                    auto optional = entry.data.dict.find(std::string_view("optional"));
+
+                    if (optional != entry.data.dict.end()) {
+                        if (optional->second.type != ValueType::Bool)
+                            throw std::runtime_error(std::format("Schema::Schema() -> expected a bool for `optional` at `{}`", childPath(path, std::string_view(entryKey))));
+
+                        isRequired = !optional->second.data.b;
+                    }
+                }
+
+                std::string_view keyText(entryKey);
+                uint32_t keyNode = compile(entry, childPath(childPath(path, "keys"), keyText));
+                keys.push_back({ std::string(keyText), keyNode, isRequired });
+            }
+
+            std::sort(keys.begin(), keys.end(), [](KeyNode const& a, KeyNode const& b) { return a.key < b.key; });
+
+            node.keysBegin = static_cast<uint32_t>(m_keys.size());
+            node.requiredCount = static_cast<uint32_t>(std::count_if(keys.begin(), keys.end(), [](KeyNode const& each) { return each.isRequired; }));
+
+            for (KeyNode& each : keys)
+                m_keys.push_back(std::move(each));
+
+            node.keysEnd = static_cast<uint32_t>(m_keys.size());
+        }
+        else if (name != "optional") {
+            throw std::runtime_error(std::format("Schema::Schema() -> unknown field `{}` at `{}`", name, path));
+        }
+    }
+
+    if (hasKeys && fields.find(std::string_view("others")) == fields.end())
+        node.others = REJECT;
+
+    m_nodes[index] = node;
+
+    return index;
+}
+
+bool Schema::check(Value const& value, std::vector<Violation>& violations) const {
+    size_t count = violations.size();
+
+    SchemaChecker checker(*this, violations);
+    walk(value, checker);
+
+    return violations.size() == count;
+}
+
+bool Schema::check(char const* chars, size_t length, std::vector<Violation>& violations) const {
+    size_t count = violations.size();
+
+    SchemaChecker checker(*this, violations);
+    Reader<SchemaChecker> reader(checker);
+    checker.reset(&reader.tokenizer());
+
+    if (!reader.read(chars, length))
+        checker.onUndefined();
+
+    return violations.size() == count;
+}
+
+void SchemaChecker::onUndefined() {
+    beginValue(ValueType::Undefined);
+}
+
+void SchemaChecker::onNull() {
+    beginValue(ValueType::Null);
+}
+
+void SchemaChecker::onBool(bool) {
+    beginValue(ValueType::Bool);
+}
+
+void SchemaChecker::onInt(intptr_t x) {
+    uint32_t index = beginValue(ValueType::Int);
+
+    if (index == 0)
+        return;
+
+    Schema::Node const& node = m_schema->m_nodes[index];
+
+    if ((node.min.isSet && (node.min.isInt ? x < node.min.i : static_cast<double>(x) < node.min.f)) ||
+        (node.max.isSet && (node.max.isInt ? x > node.max.i : static_cast<double>(x) > node.max.f)))
+    {
+        report(ViolationKind::OutOfRange, path(m_frames.size()), currentSpan());
+    }
+}
+
+void SchemaChecker::onFloat(Float x) {
+    uint32_t index = beginValue(ValueType::Float);
+
+    if (index == 0)
+        return;
+
+    Schema::Node const& node = m_schema->m_nodes[index];
+    double f = static_cast<double>(x);
+
+    // Written so that NaN is out of any range.
+    if ((node.min.isSet && !(f >= node.min.f)) || (node.max.isSet && !(f <= node.max.f)))
+        report(ViolationKind::OutOfRange, path(m_frames.size()), currentSpan());
+}
+
+void SchemaChecker::onString(std::string_view) {
+    beginValue(ValueType::String);
+}
+
+void SchemaChecker::onArrayBegin() {
+    beginContainer(ValueType::Array);
+}
+
+void SchemaChecker::onArrayEnd() {
+    m_frames.pop_back();
+}
+
+void SchemaChecker::onDictBegin() {
+    beginContainer(ValueType::Dict);
+}
+
+bool SchemaChecker::onKey(std::string_view key) {
+    Frame& frame = m_frames.back();
+    Schema::Node const& node = m_schema->m_nodes[frame.node];
+
+    auto begin = m_schema->m_keys.begin() + node.keysBegin;
+    auto end = m_schema->m_keys.begin() + node.keysEnd;
+    auto it = std::lower_bound(begin, end, key, [](Schema::KeyNode const& each, std::string_view key) { return each.key < key; });
+
+    if (it != end && it->key == key) {
+        size_t seen = frame.seenBegin + (it - begin);
+
+        if (m_seen[seen])
+            return false;
+
+        m_seen[seen] = true;
+
+        if (it->isRequired)
+            ++frame.requiredCount;
+
+        frame.key = it->key;
+        frame.isOtherKey = false;
+        m_next = it->node;
+
+        return true;
+    }
+
+    if (node.others == Schema::REJECT) {
+        Span span = currentSpan();
+        report(ViolationKind::UnknownKey, childPath(path(m_frames.size() - 1), key), span);
+
+        m_next = 0;
+
+        return true;
+    }
+
+    // Only kept if the value may have violations, which need its path.
+    if (node.others != 0) {
+        frame.otherKey = key;
+        frame.isOtherKey = true;
+    }
+
+    m_next = node.others;
+
+    return true;
+}
+
+void SchemaChecker::onDictEnd() {
+    Frame& frame = m_frames.back();
+    Schema::Node const& node = m_schema->m_nodes[frame.node];
+
+    if (frame.requiredCount < node.requiredCount) {
+        Span span = m_tokenizer != nullptr ? m_tokenizer->spanOf(frame.open, m_tokenizer->token().offset + 1) : Span();
+        std::string dictPath = path(m_frames.size() - 1);
+
+        for (uint32_t i = node.keysBegin; i < node.keysEnd; ++i) {
+            Schema::KeyNode const& key = m_schema->m_keys[i];
+
+            if (key.isRequired && !m_seen[frame.seenBegin + (i - node.keysBegin)])
+                report(ViolationKind::MissingKey, childPath(dictPath, key.key), span);
+        }
+    }
+
+    m_seen.resize(frame.seenBegin);
+    m_frames.pop_back();
+}
+
+// Finds the node of the value starting now and checks its type. Returns the
+// node, or 0 if the value is not to be checked further.
+uint32_t SchemaChecker::beginValue(ValueType type) {
+    uint32_t index;
+
+    if (m_frames.empty()) {
+        index = 1;
+    }
+    else if (!m_frames.back().isDict) {
+        Frame& frame = m_frames.back();
+        index = m_schema->m_nodes[frame.node].elements;
+        ++frame.count;
+    }
+    else {
+        index = m_next;
+    }
+
+    if (index == 0)
+        return 0;
+
+    if ((m_schema->m_nodes[index].types & typeBit(type)) == 0) {
+        report(ViolationKind::TypeMismatch, path(m_frames.size()), currentSpan());
+        return 0;
+    }
+
+    return index;
+}
+
+void SchemaChecker::beginContainer(ValueType type) {
+    uint32_t index = beginValue(type);
+    size_t open = m_tokenizer != nullptr ? m_tokenizer->token().offset : 0;
+
+    if (type == ValueType::Array) {
+        m_frames.push_back({ index, false, false, 0, {}, {}, 0, m_seen.size(), open });
+        return;
+    }
+
+    Schema::Node const& node = m_schema->m_nodes[index];
+
+    m_frames.push_back({ index, true, false, 0, {}, {}, 0, m_seen.size(), open });
+    m_seen.resize(m_seen.size() + (node.keysEnd - node.keysBegin), false);
+}
+
+void SchemaChecker::report(ViolationKind kind, std::string&& path, Span span) {
+    m_violations->push_back({ kind, std::move(path), span });
+}
+
+// The path of the current value inside the first `depth` open containers.
+std::string SchemaChecker::path(size_t depth) const {
+    std::string result;
+
+    for (size_t i = 0; i < depth; ++i) {
+        Frame const& frame = m_frames[i];
+
+        if (!frame.isDict)
+            result = childPath(result, frame.count - 1);
+        else
+            result = childPath(result, frame.isOtherKey ? std::string_view(frame.otherKey) : frame.key);
+    }
+
+    return result;
+}
@@ -0,0 +1,243 @@
+// Copyright 2025 Maicol Castro <maicolcastro.abc@gmail.com>.
+// Distributed under the MIT License.
+// See LICENSE.txt in the root directory of this project
+// or at https://opensource.org/license/mit.
+
+#include <charconv>
+#include <cmath>
+#include <format>
+#include <stdexcept>
+#include <gcl/serializer.hh>
+#include <gcl/walk.hh>
+#include "scan.hh"
+
+using namespace gcl;
+
+// Writes the events of `gcl::walk`, so that deep trees are written without
+// recursion.
+class Serializer {
+public:
+    // Output goes to `buffer`, which is emptied into `sink` whenever it grows
+    // past `BUFFER_SIZE`. Without a sink, `buffer` is the output itself.
+    Serializer(std::string& buffer, ISink* sink, SerializeOptions const& options)
+        : m_buffer{buffer}, m_sink{sink}, m_options{options}, m_depth{0}
+        , m_isEmpty{false}, m_isAfterKey{false}
+    {}
+
+    inline void write(Value const& value) {
+        walk(value, *this);
+    }
+
+    void flush();
+
+    // Undefined values have no literal.
+    inline void onUndefined() {
+        beginItem();
+        put("null");
+    }
+
+    inline void onNull() {
+        beginItem();
+        put("null");
+    }
+
+    inline void onBool(bool x) {
+        beginItem();
+        put(x ? "true" : "false");
+    }
+
+    void onInt(intptr_t x);
+    void onFloat(Float x);
+
+    inline void onString(std::string_view x) {
+        beginItem();
+        writeString(x);
+    }
+
+    inline void onArrayBegin() {
+        beginContainer('[');
+    }
+
+    inline void onArrayEnd() {
+        endContainer(']');
+    }
+
+    inline void onDictBegin() {
+        beginContainer('{');
+    }
+
+    bool onKey(std::string_view key);
+
+    inline void onDictEnd() {
+        endContainer('}');
+    }
+
+private:
+    static constexpr size_t BUFFER_SIZE = 64 * 1024;
+
+    std::string& m_buffer;
+    ISink* m_sink;
+    SerializeOptions const& m_options;
+    size_t m_depth;
+
+    // Whether the innermost container has no items written yet.
+    bool m_isEmpty;
+
+    // Whether a key was just written, which its value follows directly.
+    bool m_isAfterKey;
+
+    inline void put(char chr) {
+        m_buffer.push_back(chr);
+    }
+
+    inline void put(std::string_view text) {
+        m_buffer.append(text);
+    }
+
+    inline void putNewline() {
+        m_buffer.push_back('\n');
+        m_buffer.append(m_depth * m_options.tabSize, ' ');
+    }
+
+    // Writes what comes before an item of the innermost container, if any.
+    // Every item starts here, so the buffer is also emptied here, in both
+    // pretty and compact output.
+    inline void beginItem() {
+        if (m_sink != nullptr && m_buffer.size() >= BUFFER_SIZE)
+            flush();
+
+        if (m_isAfterKey) {
+            m_isAfterKey = false;
+            return;
+        }
+
+        if (m_depth == 0)
+            return;
+
+        if (!m_isEmpty)
+            put(',');
+
+        if (m_options.pretty)
+            putNewline();
+
+        m_isEmpty = false;
+    }
+
+    inline void beginContainer(char open) {
+        beginItem();
+        put(open);
+
+        ++m_depth;
+        m_isEmpty = true;
+    }
+
+    inline void endContainer(char close) {
+        --m_depth;
+
+        if (!m_isEmpty && m_options.pretty)
+            putNewline();
+
+        put(close);
+
+        // The container is itself an item of its parent.
+        m_isEmpty = false;
+    }
+
+    void writeString(std::string_view string);
+};
+
+void gcl::serialize(Value const& value, ISink& sink, SerializeOptions const& options) {
+    std::string buffer;
+    buffer.reserve(4096);
+
+    Serializer serializer(buffer, &sink, options);
+    serializer.write(value);
+    serializer.flush();
+}
+
+std::string gcl::serialize(Value const& value, SerializeOptions const& options) {
+    std::string output;
+
+    Serializer serializer(output, nullptr, options);
+    serializer.write(value);
+
+    return output;
+}
+
+void Serializer::flush() {
+    if (m_sink != nullptr && !m_buffer.empty()) {
+        m_sink->write(m_buffer.data(), m_buffer.size());
+        m_buffer.clear();
+    }
+}
+
+void Serializer::onInt(intptr_t x) {
+    beginItem();
+
+    char chars[24];
+    auto result = std::to_chars(chars, chars + sizeof(chars), x);
+    put(std::string_view(chars, result.ptr - chars));
+}
+
+void Serializer::onFloat(Float x) {
+    beginItem();
+
+    // Floats that are not finite have no literal.
+    if (!std::isfinite(x)) {
+        put("null");
+        return;
+    }
+
+    char chars[32];
+    auto result = std::to_chars(chars, chars + sizeof(chars), x);
+    std::string_view text(chars, result.ptr - chars);
+    put(text);
+
+    // Keep integral floats from being read back as ints.
+    if (text.find_first_of(".e") == std::string_view::npos)
+        put(".0");
+}
+
+void Serializer::writeString(std::string_view string) {
+    put('"');
+
+    // Copy the runs between characters that need escaping in bulk.
+    for (size_t index = 0;;) {
+        size_t end = scan::findStringSpecial(string.data(), index, string.length());
+        m_buffer.append(string.data() + index, end - index);
+
+        if (end == string.length())
+            break;
+
+        switch (string[end]) {
+            case '"': put("\\\""); break;
+            case '\\': put("\\\\"); break;
+            case '\n': put("\\n"); break;
+        }
+
+        index = end + 1;
+    }
+
+    put('"');
+}
+
+bool Serializer::onKey(std::string_view key) {
+    beginItem();
+
+    bool isIdentifier = !key.empty() && ((key[0] >= 'a' && key[0] <= 'z') || (key[0] >= 'A' && key[0] <= 'Z'));
+
+    for (size_t i = 1; isIdentifier && i < key.length(); ++i) {
+        char chr = key[i];
+        isIdentifier = (chr >= 'a' && chr <= 'z') || (chr >= 'A' && chr <= 'Z') || (chr >= '0' && chr <= '9') || chr == '_';
+    }
+
+    if (!isIdentifier)
+        throw std::runtime_error(std::format("gcl::serialize() -> key `{}` is not an identifier", key));
+
+    put(key);
+    put(m_options.pretty ? ": " : ":");
+
+    m_isAfterKey = true;
+
+    return true;
+}
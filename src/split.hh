@@ -0,0 +1,73 @@
+// Copyright 2025 Maicol Castro <maicolcastro.abc@gmail.com>.
+// Distributed under the MIT License.
+// See LICENSE.txt in the root directory of this project
+// or at https://opensource.org/license/mit.
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+#include "scan.hh"
+
+namespace gcl {
+
+struct Slice {
+    size_t begin;
+    size_t end;
+};
+
+// Splits the container opened at `open` into slices of at least `sliceLength`
+// bytes, cut at its top-level commas. Strings and comments are skipped, so
+// that the brackets and commas in them are not counted. Returns the offset of
+// the closing bracket, or nothing if there is none.
+inline std::optional<size_t> splitContainer(char const* chars, size_t length, size_t open, size_t sliceLength, std::vector<Slice>& slices) {
+    size_t depth = 1;
+    size_t begin = open + 1;
+
+    for (size_t i = open + 1; i < length; ++i) {
+        switch (chars[i]) {
+            case '"':
+                i = scan::findStringSpecial(chars, i + 1, length);
+
+                while (i < length && chars[i] == '\\')
+                    i = scan::findStringSpecial(chars, i + 2, length);
+
+                // Strings cannot span lines.
+                if (i >= length || chars[i] != '"')
+                    return std::nullopt;
+
+                break;
+
+            case '#':
+                i = scan::findNewline(chars, i + 1, length);
+                break;
+
+            case '[':
+            case '{':
+                ++depth;
+                break;
+
+            case ']':
+            case '}':
+                if (--depth == 0) {
+                    slices.push_back({ begin, i });
+                    return i;
+                }
+
+                break;
+
+            case ',':
+                if (depth == 1 && i - begin >= sliceLength) {
+                    slices.push_back({ begin, i });
+                    begin = i + 1;
+                }
+
+                break;
+        }
+    }
+
+    return std::nullopt;
+}
+
+} // namespace gcl
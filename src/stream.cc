@@ -0,0 +1,432 @@
+// Copyright 2025 Maicol Castro <maicolcastro.abc@gmail.com>.
+// Distributed under the MIT License.
+// See LICENSE.txt in the root directory of this project
+// or at https://opensource.org/license/mit.
+
+#include <gcl/stream.hh>
+#include <gcl/tokenizer.hh>
+#include "scan.hh"
+
+using namespace gcl;
+
+static inline bool isPunctuaction(Token const& token, Punctuaction punctuaction) {
+    return token.kind == TokenKind::Punctuaction && token.data.punctuaction == punctuaction;
+}
+
+StreamParser::StreamParser(std::pmr::memory_resource* resource)
+    : m_resource{resource}, m_tokenizer{std::make_unique<Tokenizer>()}
+    , m_buffer(), m_frames(), m_maxDepth{DEFAULT_MAX_DEPTH}, m_state{State::ExpectRoot}, m_value(), m_hasValue{false}
+    , m_cut{Cut::None}, m_scanned{0}, m_isEscaped{false}
+    , m_origin{0}, m_originNewlines{0}, m_originLastNewline{0}
+{}
+
+StreamParser::~StreamParser() = default;
+
+void StreamParser::feed(char const* chars, size_t length) {
+    if (m_state == State::Done)
+        return;
+
+    m_buffer.append(chars, length);
+
+    if (m_cut != Cut::None && !isCutEnded())
+        return;
+
+    drain(false);
+}
+
+bool StreamParser::finish() {
+    if (m_state != State::Done)
+        drain(true);
+
+    return m_hasValue;
+}
+
+void StreamParser::reset() {
+    m_buffer.clear();
+    m_frames.clear();
+    m_state = State::ExpectRoot;
+    m_value.clear();
+    m_hasValue = false;
+    m_cut = Cut::None;
+    m_scanned = 0;
+    m_isEscaped = false;
+    m_origin = 0;
+    m_originNewlines = 0;
+    m_originLastNewline = 0;
+}
+
+void StreamParser::drain(bool isLast) {
+    Tokenizer& tokenizer = *m_tokenizer;
+    tokenizer.setText(m_buffer.data(), m_buffer.length());
+    m_cut = Cut::None;
+
+    // Everything before this offset of the buffer has been parsed.
+    size_t consumed = 0;
+
+    try {
+        while (m_state != State::Done) {
+            bool isLexed = tokenizer.tryAdvance();
+
+            // A token or error that reaches the end of the buffer may just
+            // be cut short, so it is kept for more input.
+            if (!isLast && tokenizer.isAtEnd()) {
+                keepCut(consumed);
+                return;
+            }
+
+            if (!isLexed)
+                throw GclException(tokenizer.error());
+
+            Token const& token = tokenizer.token();
+
+            while (!consume(token))
+                ;
+
+            consumed = token.offset + token.length;
+        }
+    }
+    catch (GclException& exception) {
+        exception.span = absoluteSpan(exception.span);
+        throw;
+    }
+
+    discard(m_buffer.length());
+}
+
+// Drops the buffer up to the token cut at its end, or all of it if it ends in
+// whitespace or a comment, and notes what it was cut in.
+void StreamParser::keepCut(size_t consumed) {
+    char const* chars = m_buffer.data();
+    size_t length = m_buffer.length();
+    size_t begin = scan::skipWhitespace(chars, consumed, length);
+
+    while (begin < length && chars[begin] == '#') {
+        size_t newline = scan::findNewline(chars, begin + 1, length);
+
+        if (newline == length) {
+            discard(length);
+            m_cut = Cut::Comment;
+            return;
+        }
+
+        begin = scan::skipWhitespace(chars, newline, length);
+    }
+
+    discard(begin);
+
+    if (m_buffer.empty())
+        return;
+
+    m_cut = m_buffer[0] == '"' ? Cut::String : Cut::Other;
+    m_scanned = m_cut == Cut::String ? 1 : 0;
+    m_isEscaped = false;
+
+    // Only moves `m_scanned` past the token, which this text does not end.
+    isCutEnded();
+}
+
+// Scans the input after `m_scanned` for the end of the cut token, and returns
+// whether it was found. The rest of a comment is dropped as it is scanned.
+bool StreamParser::isCutEnded() {
+    char const* chars = m_buffer.data();
+    size_t length = m_buffer.length();
+
+    switch (m_cut) {
+        case Cut::None:
+            return true;
+
+        case Cut::Comment: {
+            size_t newline = scan::findNewline(chars, 0, length);
+            discard(newline);
+
+            if (newline == length)
+                return false;
+
+            m_cut = Cut::None;
+            return true;
+        }
+
+        case Cut::String:
+            for (size_t index = m_scanned; index < length; ++index) {
+                if (!m_isEscaped)
+                    index = scan::findStringSpecial(chars, index, length);
+
+                if (index == length)
+                    break;
+
+                // Strings cannot span lines, escaped or not.
+                if (chars[index] == '\n' || (!m_isEscaped && chars[index] == '"'))
+                    return true;
+
+                m_isEscaped = !m_isEscaped && chars[index] == '\\';
+            }
+
+            break;
+
+        case Cut::Other:
+            // Tokens other than strings never hold these, so they end before
+            // the first of them at the latest.
+            for (size_t index = m_scanned; index < length; ++index) {
+                switch (chars[index]) {
+                    case ' ': case '\t': case '\n': case '#': case '"':
+                    case '{': case '}': case '[': case ']': case ',': case ':':
+                        return true;
+                }
+            }
+
+            break;
+    }
+
+    m_scanned = length;
+
+    return false;
+}
+
+// Feeds a token to the state machine. Returns false if the token has not
+// been consumed and must be fed again.
+bool StreamParser::consume(Token const& token) {
+    if (m_frames.empty()) {
+        switch (m_state) {
+            case State::ExpectRoot:
+                switch (beginValue(token, m_value)) {
+                    case ValueStart::None:
+                        m_state = State::Done;
+                        break;
+
+                    case ValueStart::Scalar:
+                        m_hasValue = true;
+                        m_state = State::ExpectTrailing;
+                        break;
+
+                    case ValueStart::Implicit:
+                        m_hasValue = true;
+                        m_state = State::Done;
+                        break;
+
+                    case ValueStart::Container:
+                        break;
+                }
+
+                return true;
+
+            case State::ExpectTrailing:
+                // Like `gcl::parse`, the token after the value is lexed, so
+                // that lexing errors in it are reported, but not parsed.
+                m_state = State::Done;
+                return true;
+
+            default:
+                return true;
+        }
+    }
+
+    Frame& frame = m_frames.back();
+    bool isDict = frame.value.type == ValueType::Dict;
+
+    switch (frame.state) {
+        case State::ExpectValue: {
+            // As in `Reader::readItems`, `]` closes the array right after `[`
+            // or a trailing comma.
+            if (!isDict && isPunctuaction(token, Punctuaction::Rsqb)) {
+                Value value = std::move(frame.value);
+                m_frames.pop_back();
+                completeValue(std::move(value));
+                return true;
+            }
+
+            Value value;
+
+            switch (beginValue(token, value)) {
+                case ValueStart::None:
+                    throw GclException(GclErrorID::ExpectedValue, m_tokenizer->spanOf(token), std::format("expected a value but found `{}`", token));
+
+                case ValueStart::Scalar:
+                    completeValue(std::move(value));
+                    return true;
+
+                case ValueStart::Implicit:
+                    completeValue(std::move(value));
+                    return false;
+
+                case ValueStart::Container:
+                    return true;
+            }
+
+            return true;
+        }
+
+        case State::ExpectSeparator:
+            if (isPunctuaction(token, Punctuaction::Comma)) {
+                frame.state = isDict ? State::ExpectKey : State::ExpectValue;
+                return true;
+            }
+
+            if (isPunctuaction(token, isDict ? Punctuaction::Rbrace : Punctuaction::Rsqb)) {
+                Value value = std::move(frame.value);
+                m_frames.pop_back();
+                completeValue(std::move(value));
+                return true;
+            }
+
+            throw GclException(GclErrorID::ExpectedPunctuaction, m_tokenizer->spanOf(token), std::format("expected `,` but found `{}`", token));
+
+        case State::ExpectKey:
+            if (token.kind == TokenKind::Identifier) {
+                auto it = frame.value.data.dict.try_emplace(Key(token.data.identifier, m_resource));
+
+                if (!it.second)
+                    throw GclException(GclErrorID::KeyAlreadyDefined, m_tokenizer->spanOf(token), std::format("key `{}` already defined", token.data.identifier));
+
+                frame.slot = &it.first->second;
+                frame.state = State::ExpectColon;
+                return true;
+            }
+
+            if (isPunctuaction(token, Punctuaction::Rbrace)) {
+                Value value = std::move(frame.value);
+                m_frames.pop_back();
+                completeValue(std::move(value));
+                return true;
+            }
+
+            throw GclException(GclErrorID::ExpectedPunctuaction, m_tokenizer->spanOf(token), std::format("expected `}}` but found `{}`", token));
+
+        case State::ExpectColon:
+            if (!isPunctuaction(token, Punctuaction::Colon))
+                throw GclException(GclErrorID::ExpectedPunctuaction, m_tokenizer->spanOf(token), std::format("expected `:` but found `{}`", token));
+
+            frame.state = State::ExpectValue;
+            return true;
+
+        default:
+            return true;
+    }
+}
+
+// Starts parsing a value at `token`, the same way `Reader::readValue` does.
+StreamParser::ValueStart StreamParser::beginValue(Token const& token, Value& output) {
+    switch (token.kind) {
+        case TokenKind::Punctuaction:
+            if ((token.data.punctuaction == Punctuaction::Lbrace || token.data.punctuaction == Punctuaction::Lsqb) && m_frames.size() >= m_maxDepth)
+                throw GclException(GclErrorID::NestingTooDeep, m_tokenizer->spanOf(token), "containers nested too deeply");
+
+            if (token.data.punctuaction == Punctuaction::Lbrace) {
+                m_frames.push_back({ Value(Dict(m_resource)), State::ExpectKey, nullptr });
+                return ValueStart::Container;
+            }
+
+            if (token.data.punctuaction == Punctuaction::Lsqb) {
+                m_frames.push_back({ Value(Array(m_resource)), State::ExpectValue, nullptr });
+                return ValueStart::Container;
+            }
+
+            // Any other punctuaction is an undefined value that is not
+            // consumed.
+            return ValueStart::Implicit;
+
+        case TokenKind::String:
+            output.type = ValueType::String;
+            new (&output.data.string) String(token.data.string, m_resource);
+            return ValueStart::Scalar;
+
+        case TokenKind::Int:
+            output.type = ValueType::Int;
+            output.data.i = token.data.i;
+            return ValueStart::Scalar;
+
+        case TokenKind::Float:
+            output.type = ValueType::Float;
+            output.data.f = token.data.f;
+            return ValueStart::Scalar;
+
+        case TokenKind::Identifier:
+            if (token.data.identifier == "true") {
+                output.type = ValueType::Bool;
+                output.data.b = true;
+            }
+            else if (token.data.identifier == "false") {
+                output.type = ValueType::Bool;
+                output.data.b = false;
+            }
+            else if (token.data.identifier == "null") {
+                output.type = ValueType::Null;
+                output.data.i = 0;
+            }
+            else {
+                return ValueStart::None;
+            }
+
+            return ValueStart::Scalar;
+
+        default:
+            return ValueStart::None;
+    }
+}
+
+void StreamParser::completeValue(Value&& value) {
+    if (m_frames.empty()) {
+        m_value = std::move(value);
+        m_hasValue = true;
+        m_state = State::ExpectTrailing;
+        return;
+    }
+
+    Frame& parent = m_frames.back();
+
+    if (parent.value.type == ValueType::Array)
+        parent.value.data.array.push_back(std::move(value));
+    else
+        *parent.slot = std::move(value);
+
+    parent.state = State::ExpectSeparator;
+}
+
+// Drops the first `length` bytes of the buffer, remembering how many lines
+// they spanned.
+void StreamParser::discard(size_t length) {
+    for (size_t i = scan::findNewline(m_buffer.data(), 0, length); i < length; i = scan::findNewline(m_buffer.data(), i + 1, length)) {
+        // As in `Tokenizer::spanOf()`, a newline at the very start of the
+        // input does not start a new line.
+        if (m_origin + i != 0) {
+            m_originNewlines += 1;
+            m_originLastNewline = m_origin + i;
+        }
+    }
+
+    m_buffer.erase(0, length);
+    m_origin += length;
+}
+
+Span StreamParser::absoluteSpan(Span span) const {
+    span.beginOffset += m_origin;
+    span.endOffset += m_origin;
+    resolvePosition(span.beginOffset, span.beginLineNumber, span.beginColumnNumber);
+    resolvePosition(span.endOffset, span.endLineNumber, span.endColumnNumber);
+
+    return span;
+}
+
+void StreamParser::resolvePosition(size_t offset, size_t& lineNumber, size_t& columnNumber) const {
+    size_t end = m_origin + m_buffer.length();
+
+    // The end of the input is reported at its last character.
+    if (offset >= end)
+        offset = end > 0 ? end - 1 : 0;
+
+    size_t newlineCount = m_originNewlines;
+    size_t lastNewline = m_originLastNewline;
+
+    if (offset >= m_origin) {
+        size_t length = offset - m_origin + 1;
+
+        for (size_t i = scan::findNewline(m_buffer.data(), 0, length); i < length; i = scan::findNewline(m_buffer.data(), i + 1, length)) {
+            if (m_origin + i != 0) {
+                newlineCount += 1;
+                lastNewline = m_origin + i;
+            }
+        }
+    }
+
+    lineNumber = 1 + newlineCount;
+    columnNumber = newlineCount != 0 ? offset - lastNewline : offset;
+}
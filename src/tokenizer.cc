@@ -3,8 +3,13 @@
 // See LICENSE.txt in the root directory of this project
 // or at https://opensource.org/license/mit.
 
+#include <algorithm>
 #include <array>
-#include "tokenizer.hh"
+#include <charconv>
+#include <cstring>
+#include <gcl/index.hh>
+#include <gcl/tokenizer.hh>
+#include "scan.hh"
 
 using namespace gcl;
 
@@ -36,7 +41,7 @@ std::format_context::iterator std::formatter<Token>::format(Token const& token,
             return std::formatter<intptr_t>{}.format(token.data.i, context);
 
         case TokenKind::Float:
-            return std::formatter<intptr_t>{}.format(token.data.f, context);
+            return std::formatter<Float>{}.format(token.data.f, context);
 
         case TokenKind::Identifier:
             return std::formatter<std::string_view>{}.format(token.data.identifier, context);
@@ -52,27 +57,84 @@ std::format_context::iterator std::formatter<Token>::format(Token const& token,
     }
 }
 
+// The low bits of a character class select the routine that lexes tokens
+// starting with that character, the high bits are flags.
+enum CharClass : uint8_t {
+    LEX_MISC = 0,
+    LEX_IDENTIFIER = 1,
+    LEX_NUMBER = 2,
+    LEX_PUNCTUACTION = 3,
+    LEX_STRING = 4,
+    LEX_MASK = 0x7,
+
+    CHAR_ALPHA = 1 << 3,
+    CHAR_DIGIT = 1 << 4,
+    CHAR_HEX_DIGIT = 1 << 5,
+    CHAR_BIN_DIGIT = 1 << 6,
+    CHAR_IDENTIFIER = 1 << 7,
+};
+
+static constexpr std::array<uint8_t, 256> makeCharClasses() {
+    std::array<uint8_t, 256> classes = {};
+
+    for (int chr = 'a'; chr <= 'z'; ++chr) {
+        classes[chr] = LEX_IDENTIFIER | CHAR_ALPHA | CHAR_IDENTIFIER;
+        classes[chr - 'a' + 'A'] = LEX_IDENTIFIER | CHAR_ALPHA | CHAR_IDENTIFIER;
+    }
+
+    for (int chr = 'a'; chr <= 'f'; ++chr) {
+        classes[chr] |= CHAR_HEX_DIGIT;
+        classes[chr - 'a' + 'A'] |= CHAR_HEX_DIGIT;
+    }
+
+    for (int chr = '0'; chr <= '9'; ++chr)
+        classes[chr] = LEX_NUMBER | CHAR_DIGIT | CHAR_HEX_DIGIT | CHAR_IDENTIFIER;
+
+    classes['0'] |= CHAR_BIN_DIGIT;
+    classes['1'] |= CHAR_BIN_DIGIT;
+    classes['_'] = CHAR_IDENTIFIER;
+    classes['-'] = LEX_NUMBER;
+    classes['+'] = LEX_NUMBER;
+
+    for (char chr : { '{', '}', '[', ']', ',', ':' })
+        classes[chr] = LEX_PUNCTUACTION;
+
+    classes['"'] = LEX_STRING;
+
+    return classes;
+}
+
+static constexpr std::array<uint8_t, 256> CHAR_CLASSES = makeCharClasses();
+
+static inline uint8_t charClass(char chr) {
+    return CHAR_CLASSES[static_cast<unsigned char>(chr)];
+}
+
 static inline bool isAlpha(char chr) {
-    return (chr >= 'a' && chr <= 'z') || (chr >= 'A' && chr <= 'Z');
+    return charClass(chr) & CHAR_ALPHA;
 }
 
 static inline bool isDigit(char chr, int base = 10) {
     switch (base) {
         case 10:
-            return chr >= '0' && chr <= '9';
+            return charClass(chr) & CHAR_DIGIT;
 
         case 16:
-            return (chr >= '0' && chr <= '9') || (chr >= 'A' && chr <= 'F') || (chr >= 'a' && chr <= 'f');
+            return charClass(chr) & CHAR_HEX_DIGIT;
 
         case 2:
-            return chr >= '0' && chr <= '1';
+            return charClass(chr) & CHAR_BIN_DIGIT;
     }
 
     return false;
 }
 
 static inline bool isAlnum(char chr) {
-    return isAlpha(chr) || isDigit(chr);
+    return charClass(chr) & (CHAR_ALPHA | CHAR_DIGIT);
+}
+
+static inline bool isIdentifierChar(char chr) {
+    return charClass(chr) & CHAR_IDENTIFIER;
 }
 
 static inline int charToDigit(char chr, int base) {
@@ -94,179 +156,366 @@ static inline int charToDigit(char chr, int base) {
 }
 
 bool Tokenizer::advance() {
-    static std::array<bool (Tokenizer::*)(), 5> const READ_METHODS = {
-        &Tokenizer::readIdentifier,
-        &Tokenizer::readNumber,
-        &Tokenizer::readPunctuaction,
-        &Tokenizer::readString,
-        &Tokenizer::readMisc,
-    };
-
-    skipWhitespace();
-
-    while (m_char == '#') {
-        skipComment();
+    if (!tryAdvance())
+        throw GclException(m_error);
+
+    return m_token.kind != TokenKind::Eof;
+}
+
+bool Tokenizer::tryAdvance() {
+    m_hasError = false;
+
+    if (m_structuralIndex != nullptr) {
+        skipToToken();
+    }
+    else {
         skipWhitespace();
+
+        while (m_char == '#') {
+            skipComment();
+            skipWhitespace();
+        }
     }
 
     m_token.reset();
-    m_token.span.beginLineNumber = m_lineNumber;
-    m_token.span.beginColumnNumber = m_columNumber;
-    m_token.span.endLineNumber = m_lineNumber;
-    m_token.span.endColumnNumber = m_columNumber;
+    m_token.offset = m_index;
+
+    switch (charClass(m_char) & LEX_MASK) {
+        case LEX_IDENTIFIER: readIdentifier(); break;
+        case LEX_NUMBER: readNumber(); break;
+        case LEX_PUNCTUACTION: readPunctuaction(); break;
+        case LEX_STRING: readString(); break;
+        default: readMisc(); break;
+    }
 
-    for (auto method : READ_METHODS) {
-        if ((this->*method)())
-            break;
+    m_token.length = m_index - m_token.offset;
+
+    return !m_hasError;
+}
+
+// Errors are reported at the start of the token, which is left as `Eof`.
+void Tokenizer::fail(GclErrorID errorID, char chr, int base) {
+    m_token.kind = TokenKind::Eof;
+    m_error = { errorID, spanOf(m_token.offset, m_token.offset), chr, base, text() };
+    m_hasError = true;
+}
+
+void Tokenizer::setText(StructuralIndex const& index) {
+    setText(index.data(), index.length());
+    m_structuralIndex = &index;
+}
+
+size_t Tokenizer::findClose(size_t open) const {
+    if (m_structuralIndex != nullptr) {
+        std::vector<uint32_t> const& tokens = m_structuralIndex->tokens();
+
+        // Usually the current token, which `m_nextToken` is right after.
+        size_t token = m_nextToken > 0 && tokens[m_nextToken - 1] == open
+            ? m_nextToken - 1
+            : std::lower_bound(tokens.begin(), tokens.end(), open) - tokens.begin();
+
+        if (token < tokens.size() && tokens[token] == open)
+            return m_structuralIndex->closeOf(token);
     }
 
-    m_token.span.endLineNumber = m_lineNumber;
-    m_token.span.endColumnNumber = m_columNumber;
+    size_t depth = 0;
 
-    return m_token.kind != TokenKind::Eof;
+    for (size_t i = open; i < m_length; ++i) {
+        switch (m_chars[i]) {
+            case '"':
+                i = scan::findStringSpecial(m_chars, i + 1, m_length);
+
+                while (i < m_length && m_chars[i] == '\\')
+                    i = scan::findStringSpecial(m_chars, i + 2, m_length);
+
+                // Strings cannot span lines.
+                if (i >= m_length || m_chars[i] != '"')
+                    return SIZE_MAX;
+
+                break;
+
+            case '#':
+                i = scan::findNewline(m_chars, i + 1, m_length);
+                break;
+
+            case '[':
+            case '{':
+                ++depth;
+                break;
+
+            case ']':
+            case '}':
+                if (--depth == 0)
+                    return (m_chars[i] == ']') == (m_chars[open] == '[') ? i : SIZE_MAX;
+
+                break;
+        }
+    }
+
+    return SIZE_MAX;
+}
+
+Span Tokenizer::spanOf(size_t begin, size_t end) {
+    if (!m_hasNewlineIndex) {
+        m_newlines.clear();
+
+        // A newline at the very start is never stepped onto, so it does not
+        // start a new line. Neither do those decoded in situ, which are found
+        // in the same order.
+        auto decoded = m_decodedNewlines.begin();
+
+        for (size_t i = scan::findNewline(m_chars, 1, m_length); i < m_length; i = scan::findNewline(m_chars, i + 1, m_length)) {
+            if (decoded != m_decodedNewlines.end() && *decoded == i)
+                ++decoded;
+            else
+                m_newlines.push_back(i);
+        }
+
+        m_hasNewlineIndex = true;
+    }
+
+    Span span;
+    span.beginOffset = begin;
+    span.endOffset = end;
+    resolvePosition(begin, span.beginLineNumber, span.beginColumnNumber);
+    resolvePosition(end, span.endLineNumber, span.endColumnNumber);
+
+    return span;
+}
+
+void Tokenizer::resolvePosition(size_t offset, size_t& lineNumber, size_t& columnNumber) {
+    // The end of the input is reported at its last character.
+    if (offset >= m_length)
+        offset = m_length > 0 ? m_length - 1 : 0;
+
+    size_t newlineCount = std::upper_bound(m_newlines.begin(), m_newlines.end(), offset) - m_newlines.begin();
+
+    lineNumber = 1 + newlineCount;
+    columnNumber = newlineCount != 0 ? offset - m_newlines[newlineCount - 1] : offset;
 }
 
 bool Tokenizer::advanceChar() {
     if (m_index + 1 >= m_length) {
+        m_index = m_length;
         m_char = '\0';
         return false;
     }
 
     m_char = m_chars[++m_index];
 
-    if (m_char == '\n') {
-        m_lineNumber += 1;
-        m_columNumber = 0;
+    return true;
+}
+
+void Tokenizer::advanceTo(size_t index) {
+    if (index >= m_length) {
+        m_index = m_length;
+        m_char = '\0';
     }
     else {
-        m_columNumber += 1;
+        m_index = index;
+        m_char = m_chars[index];
     }
-
-    return true;
 }
 
 void Tokenizer::skipWhitespace() {
-    for (;;) {
-        switch (m_char) {
-            case ' ':
-            case '\t':
-            case '\n':
-                advanceChar();
-                continue;
-
-            default:
-                break;
-        }
-
-        break;
-    }
+    advanceTo(scan::skipWhitespace(m_chars, m_index, m_length));
 }
 
 void Tokenizer::skipComment() {
-    advanceChar();
-
-    while (m_char != '\n') {
-        if (!advanceChar())
-            break;
-    }
+    advanceTo(scan::findNewline(m_chars, m_index + 1, m_length));
 }
 
-bool Tokenizer::readIdentifier() {
-    if (!isAlpha(m_char))
-        return false;
+// Moves to the next token of the index, unless the last token ended right
+// before another character that is not whitespace or a comment, where lexing
+// goes on as it would without the index.
+void Tokenizer::skipToToken() {
+    std::vector<uint32_t> const& tokens = m_structuralIndex->tokens();
 
-    std::string identifier;
-    identifier.reserve(8);
-    identifier.push_back(m_char);
+    while (m_nextToken < tokens.size() && tokens[m_nextToken] < m_index)
+        ++m_nextToken;
 
-    while (advanceChar() && (isAlnum(m_char) || m_char == '_'))
-        identifier.push_back(m_char);
+    if (m_index < m_length && (m_char == ' ' || m_char == '\t' || m_char == '\n' || m_char == '#'))
+        advanceTo(m_nextToken < tokens.size() ? tokens[m_nextToken] : m_length);
 
-    m_token.kind = TokenKind::Identifier;
-    new (&m_token.data) std::string(std::move(identifier));
+    if (m_nextToken < tokens.size() && tokens[m_nextToken] == m_index)
+        ++m_nextToken;
+}
 
-    return true;
+void Tokenizer::seekToken() {
+    std::vector<uint32_t> const& tokens = m_structuralIndex->tokens();
+    m_nextToken = std::lower_bound(tokens.begin(), tokens.end(), m_index) - tokens.begin();
 }
 
-bool Tokenizer::readNumber() {
-    // TODO: Add suport to floats.
+void Tokenizer::readIdentifier() {
+    size_t begin = m_index;
 
-    if (!isDigit(m_char) && m_char != '-' && m_char != '+')
-        return false;
+    while (advanceChar() && isIdentifierChar(m_char))
+        ;
 
+    m_token.kind = TokenKind::Identifier;
+    m_token.data.identifier = std::string_view(m_chars + begin, m_index - begin);
+}
+
+void Tokenizer::readNumber() {
+    size_t begin = m_index;
     bool isNeg = false;
     int base = 10;
 
-    if (!isDigit(m_char)) {
-        if (m_char == '-') {
-            isNeg = true;
-            advanceChar();
+    if (m_char == '-' || m_char == '+') {
+        isNeg = m_char == '-';
+        advanceChar();
+
+        if (!isDigit(m_char)) {
+            fail(GclErrorID::ExpectedNumber, m_chars[begin]);
+            return;
         }
-        else if (m_char == '+') {
-            // isNeg = false;
-            advanceChar();
+    }
+
+    if (m_char == '0' && m_index + 1 < m_length) {
+        switch (m_chars[m_index + 1]) {
+            case 'b':
+            case 'B':
+                base = 2;
+                break;
+
+            case 'x':
+            case 'X':
+                base = 16;
+                break;
         }
-        else {
-            throw GclException(GclErrorID::UnknownChar, m_token.span, std::format("unknown character `{}`", m_char));
+
+        if (base != 10) {
+            advanceTo(m_index + 2);
+
+            if (!isDigit(m_char, base)) {
+                fail(GclErrorID::InvalidDigit, m_char, base);
+                return;
+            }
         }
     }
 
-    if (m_char == '0') {
-        advanceChar();
+    if (base == 10) {
+        readDecimal(begin, isNeg);
+        return;
+    }
 
-        if (!isDigit(m_char)) {
-            switch (m_char) {
-                case 'b':
-                case 'B':
-                    base = 2;
-                    break;
-
-                case 'x':
-                case 'X':
-                    base = 16;
-                    break;
-
-                default:
-                    m_token.kind = TokenKind::Int;
-                    m_token.data.i = 0;
-                    return true;
-            }
+    // Binary and hexadecimal numbers are bit patterns, so they may use the
+    // sign bit.
+    uintptr_t value = 0;
+    bool isOutOfRange = false;
+
+    for (; isDigit(m_char, base); advanceChar()) {
+        uintptr_t digit = charToDigit(m_char, base);
 
-            advanceChar();
+        if (value > (UINTPTR_MAX - digit) / base)
+            isOutOfRange = true;
+
+        value = value * base + digit;
+    }
 
-            if (!isDigit(m_char, base))
-                throw GclException(GclErrorID::InvalidDigit, m_token.span, std::format("invalid digit `{}` for base {}", m_char, base));
+    if (!checkNumberEnd(base))
+        return;
+
+    if (isOutOfRange) {
+        fail(GclErrorID::ValueOutOfRange, '\0');
+        return;
+    }
+
+    m_token.kind = TokenKind::Int;
+    m_token.data.i = isNeg ? -value : value;
+}
+
+// Lexes the rest of a decimal number from its first digit, as an int unless
+// it has a fraction or an exponent.
+void Tokenizer::readDecimal(size_t begin, bool isNeg) {
+    size_t digits = m_index;
+    size_t end = scan::skipDigits(m_chars, m_index, m_length);
+    bool isFloat = false;
+
+    if (end < m_length && m_chars[end] == '.') {
+        size_t fraction = end + 1;
+        end = scan::skipDigits(m_chars, fraction, m_length);
+
+        if (end == fraction) {
+            advanceTo(end);
+            fail(GclErrorID::ExpectedNumber, '.');
+            return;
         }
+
+        isFloat = true;
     }
 
-    uintptr_t value = charToDigit(m_char, base);
+    if (end < m_length && (m_chars[end] == 'e' || m_chars[end] == 'E')) {
+        size_t exponent = end + 1;
+
+        if (exponent < m_length && (m_chars[exponent] == '-' || m_chars[exponent] == '+'))
+            ++exponent;
+
+        end = scan::skipDigits(m_chars, exponent, m_length);
+
+        if (end == exponent) {
+            advanceTo(end);
+            fail(GclErrorID::ExpectedNumber, m_chars[exponent - 1]);
+            return;
+        }
 
-    while (advanceChar() && isDigit(m_char, base)) {
-        value *= base;
-        value += charToDigit(m_char, base);
+        isFloat = true;
     }
 
-    if (isAlnum(m_char)) {
-        char invalidDigitChr = m_char;
+    advanceTo(end);
 
-        advanceChar();
+    if (!checkNumberEnd(10))
+        return;
+
+    if (isFloat) {
+        // `std::from_chars` is correctly rounded, but takes no leading plus.
+        Float value;
+        auto result = std::from_chars(m_chars + (m_chars[begin] == '+' ? begin + 1 : begin), m_chars + end, value);
 
-        while (isAlnum(m_char))
-            advanceChar();
+        if (result.ec != std::errc()) {
+            fail(GclErrorID::ValueOutOfRange, '\0');
+            return;
+        }
 
-        throw GclException(GclErrorID::InvalidDigit, m_token.span, std::format("invalid digit `{}` for base {}", invalidDigitChr, base));
+        m_token.kind = TokenKind::Float;
+        m_token.data.f = value;
+
+        return;
     }
 
-    if (isNeg)
-        value = -value;
+    // Any 19 digits fit in 64 bits, and more never fit in an `intptr_t`.
+    while (digits + 1 < end && m_chars[digits] == '0')
+        ++digits;
+
+    uint64_t value = end - digits <= 19 ? scan::parseDigits(m_chars + digits, end - digits) : UINT64_MAX;
+
+    if (value > uint64_t(INTPTR_MAX) + isNeg) {
+        fail(GclErrorID::ValueOutOfRange, '\0');
+        return;
+    }
 
     m_token.kind = TokenKind::Int;
-    m_token.data.i = value;
+    m_token.data.i = isNeg ? uintptr_t(0) - uintptr_t(value) : uintptr_t(value);
+}
 
-    return true;
+// Reports the letters or digits right after a number as an invalid digit.
+bool Tokenizer::checkNumberEnd(int base) {
+    if (!isAlnum(m_char))
+        return true;
+
+    char invalidDigitChr = m_char;
+
+    advanceChar();
+
+    while (isAlnum(m_char))
+        advanceChar();
+
+    fail(GclErrorID::InvalidDigit, invalidDigitChr, base);
+
+    return false;
 }
 
-bool Tokenizer::readPunctuaction() {
+void Tokenizer::readPunctuaction() {
     Punctuaction punctuaction;
 
     switch (m_char) {
@@ -278,77 +527,121 @@ bool Tokenizer::readPunctuaction() {
         case ':': punctuaction = Punctuaction::Colon; break;
 
         default:
-            return false;
+            return;
     }
 
     advanceChar();
 
     m_token.kind = TokenKind::Punctuaction;
     m_token.data.punctuaction = punctuaction;
-
-    return true;
 }
 
-bool Tokenizer::readString() {
-    if (m_char != '"')
-        return false;
+void Tokenizer::readString() {
+    size_t begin = m_index + 1;
+    bool hasEscapes = false;
+
+    // In situ, where the decoded string ends in the text.
+    size_t decodedEnd = 0;
 
-    std::string string;
-    string.reserve(10);
+    advanceChar();
 
-    while (advanceChar() && m_char != '"') {
-        if (m_char == '\n')
-            throw GclException(GclErrorID::ExpectedStringEnd, m_token.span, std::format("expected string end"));
+    for (;;) {
+        size_t end = scan::findStringSpecial(m_chars, m_index, m_length);
 
-        if (m_char == '\\') {
-            advanceChar();
+        if (hasEscapes) {
+            if (m_inSituChars != nullptr) {
+                std::memmove(m_inSituChars + decodedEnd, m_chars + m_index, end - m_index);
+                decodedEnd += end - m_index;
+            }
+            else {
+                m_scratch.append(m_chars + m_index, end - m_index);
+            }
+        }
 
-            switch (m_char) {
-                case 'n':
-                    string.push_back('\n');
-                    break;
+        advanceTo(end);
 
-                case 't':
-                    string.push_back('\t');
-                    break;
+        if (m_index >= m_length || m_char == '\n') {
+            fail(GclErrorID::ExpectedStringEnd, m_char);
+            return;
+        }
 
-                case '\\':
-                    string.push_back('\\');
-                    break;
+        if (m_char == '"')
+            break;
 
-                case '"':
-                    string.push_back('"');
-                    break;
+        // Only strings with escape sequences are copied, and only from the
+        // first escape onwards. In situ, they are decoded over themselves,
+        // which never gets ahead of the characters still to be read.
+        if (!hasEscapes) {
+            if (m_inSituChars != nullptr)
+                decodedEnd = m_index;
+            else
+                m_scratch.assign(m_chars + begin, m_index - begin);
 
-                default:
-                    throw GclException(GclErrorID::InvalidEscape, m_token.span, std::format("invalid escape sequence `{}`", m_char));
-            }
+            hasEscapes = true;
+        }
+
+        advanceChar();
+
+        char decoded;
+
+        switch (m_char) {
+            case 'n':
+                decoded = '\n';
+                break;
+
+            case 't':
+                decoded = '\t';
+                break;
+
+            case '\\':
+                decoded = '\\';
+                break;
+
+            case '"':
+                decoded = '"';
+                break;
+
+            default:
+                fail(GclErrorID::InvalidEscape, m_char);
+                return;
+        }
+
+        if (m_inSituChars != nullptr) {
+            // Not a line of the text, for `spanOf()`.
+            if (decoded == '\n')
+                m_decodedNewlines.push_back(decodedEnd);
+
+            m_inSituChars[decodedEnd++] = decoded;
         }
         else {
-            string.push_back(m_char);
+            m_scratch.push_back(decoded);
         }
+
+        advanceChar();
     }
 
-    if (m_char != '"')
-        throw GclException(GclErrorID::ExpectedStringEnd, m_token.span, std::format("expected string end"));
+    size_t end = m_index;
 
     advanceChar();
 
     m_token.kind = TokenKind::String;
-    new (&m_token.data.string) std::string(std::move(string));
 
-    return true;
+    if (!hasEscapes)
+        m_token.data.string = std::string_view(m_chars + begin, end - begin);
+    else if (m_inSituChars != nullptr)
+        m_token.data.string = std::string_view(m_chars + begin, decodedEnd - begin);
+    else
+        m_token.data.string = std::string_view(m_scratch);
 }
 
-bool Tokenizer::readMisc() {
+void Tokenizer::readMisc() {
     switch (m_char) {
         case '\0':
             m_token.kind = TokenKind::Eof;
             break;
 
         default:
-            throw GclException(GclErrorID::UnknownChar, m_token.span, std::format("unknown character `{}`", m_char));
+            fail(GclErrorID::UnknownChar, m_char);
+            break;
     }
-
-    return true;
 }
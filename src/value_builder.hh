@@ -0,0 +1,192 @@
+// Copyright 2025 Maicol Castro <maicolcastro.abc@gmail.com>.
+// Distributed under the MIT License.
+// See LICENSE.txt in the root directory of this project
+// or at https://opensource.org/license/mit.
+
+#pragma once
+
+#include <memory_resource>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+#include <gcl/value.hh>
+
+namespace gcl {
+
+// Builds a `Value` tree from reader events. Values are constructed in place:
+// array elements and dict entries are inserted first and then filled in.
+// Keys are interned in `keys` if given, otherwise each one is allocated.
+//
+// Flat dicts are appended to as their keys come and sorted once they end, so
+// that keys out of order cost no moves, and keys defined twice are found then.
+class ValueBuilder {
+public:
+    ValueBuilder(Value& output, std::pmr::memory_resource* resource, KeyPool* keys = nullptr)
+        : m_output{&output}, m_resource{resource}, m_keys{keys}, m_containers(), m_slot{nullptr}
+        , m_borrowsStrings{false}, m_keyViews()
+    {
+        m_containers.reserve(16);
+    }
+
+    // Builds the next value into `output` instead, keeping the capacity of the
+    // container stack.
+    inline void reset(Value& output, std::pmr::memory_resource* resource, KeyPool* keys = nullptr) {
+        m_output = &output;
+        m_resource = resource;
+        m_keys = keys;
+        m_containers.clear();
+        m_slot = nullptr;
+        m_borrowsStrings = false;
+        m_keyViews.clear();
+    }
+
+    // Whether strings may point to the characters of their events instead
+    // of copying them, which must then outlive the value. Only compact
+    // strings can.
+    inline void setBorrowsStrings(bool borrowsStrings) {
+        m_borrowsStrings = borrowsStrings;
+    }
+
+    inline void onUndefined() {
+        nextSlot() = Value();
+    }
+
+    inline void onNull() {
+        nextSlot() = Value(nullptr);
+    }
+
+    inline void onBool(bool x) {
+        nextSlot() = Value(x);
+    }
+
+    inline void onInt(intptr_t x) {
+        nextSlot() = Value(x);
+    }
+
+    inline void onFloat(Float x) {
+        nextSlot() = Value(x);
+    }
+
+    inline void onString(std::string_view x) {
+#ifdef GCL_COMPACT_VALUE
+        if (m_borrowsStrings) {
+            nextSlot() = Value(String::borrow(x, m_resource));
+            return;
+        }
+#endif
+
+        nextSlot() = Value(String(x, m_resource));
+    }
+
+    inline void onArrayBegin() {
+        Value& slot = nextSlot();
+        slot = Value(Array(m_resource));
+        m_containers.push_back(&slot);
+    }
+
+    inline void onArrayEnd() {
+        m_containers.pop_back();
+    }
+
+    inline void onDictBegin() {
+        Value& slot = nextSlot();
+        slot = Value(Dict(m_resource));
+        m_containers.push_back(&slot);
+    }
+
+    inline bool onKey(std::string_view key) {
+        Dict& dict = m_containers.back()->data.dict;
+
+    #if defined(GCL_COMPACT_VALUE) || defined(GCL_FLAT_DICT)
+        m_slot = &dict.appendUnsorted(m_keys != nullptr ? m_keys->intern(key) : Key(key, m_resource));
+        m_keyViews.push_back(key);
+
+        return true;
+    #else
+        auto it = dict.try_emplace(m_keys != nullptr ? m_keys->intern(key) : Key(key, m_resource));
+        m_slot = &it.first->second;
+
+        return it.second;
+    #endif
+    }
+
+    // Returns the first key defined twice in the dict, as given to `onKey()`,
+    // or an empty view if there is none.
+    inline std::string_view onDictEnd() {
+    #if defined(GCL_COMPACT_VALUE) || defined(GCL_FLAT_DICT)
+        Dict& dict = m_containers.back()->data.dict;
+        m_containers.pop_back();
+
+        size_t begin = m_keyViews.size() - dict.size();
+        std::string_view duplicate;
+
+        if (dict.sortEntries() != dict.end()) {
+            duplicate = findDuplicate(begin);
+            dict.eraseDuplicates();
+        }
+
+        m_keyViews.resize(begin);
+
+        return duplicate;
+    #else
+        m_containers.pop_back();
+
+        return std::string_view();
+    #endif
+    }
+
+    // Sorts the dicts left open by a read that failed, so that the partial
+    // value is still a valid one.
+    inline void onError() {
+    #if defined(GCL_COMPACT_VALUE) || defined(GCL_FLAT_DICT)
+        // Innermost first, as sorting a dict moves the containers in it.
+        for (auto it = m_containers.rbegin(); it != m_containers.rend(); ++it) {
+            Dict& dict = (*it)->data.dict;
+
+            if ((*it)->type == ValueType::Dict && dict.sortEntries() != dict.end())
+                dict.eraseDuplicates();
+        }
+    #endif
+
+        m_containers.clear();
+        m_keyViews.clear();
+    }
+
+private:
+    Value* m_output;
+    std::pmr::memory_resource* m_resource;
+    KeyPool* m_keys;
+    std::vector<Value*> m_containers;
+    Value* m_slot;
+    bool m_borrowsStrings;
+
+    // The keys given to the open flat dicts, in order. The reader passes
+    // views into the text it reads, so they outlive the dict.
+    std::vector<std::string_view> m_keyViews;
+
+    // The first of the keys from `begin` on that repeats one before it.
+    std::string_view findDuplicate(size_t begin) const {
+        std::unordered_set<std::string_view> seen;
+
+        for (size_t i = begin; i < m_keyViews.size(); ++i) {
+            if (!seen.insert(m_keyViews[i]).second)
+                return m_keyViews[i];
+        }
+
+        return std::string_view();
+    }
+
+    inline Value& nextSlot() {
+        if (m_containers.empty())
+            return *m_output;
+
+        Value& container = *m_containers.back();
+
+        if (container.type == ValueType::Array)
+            return container.data.array.emplace_back();
+
+        return *m_slot;
+    }
+};
+
+} // namespace gcl